@@ -0,0 +1,69 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/char_convertions.hpp>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> numbers()
+    {
+        std::vector<std::string> output;
+        std::uint64_t            value = 1;
+        for (int a = 0; a < 1024; a++)
+        {
+            output.push_back(std::to_string(value % (std::uint64_t(1) << (a % 63 + 1))));
+            value = value * 6364136223846793005 + 1442695040888963407;
+        }
+        return output;
+    }
+} // namespace
+
+TEST_CASE("from_chars", "[benchmark][char_convertions]")
+{
+    auto const texts = numbers();
+
+    BENCHMARK("ljh::from_chars uint64 x1024")
+    {
+        std::uint64_t sum = 0;
+        for (auto& text : texts)
+        {
+            std::uint64_t value = 0;
+            ljh::from_chars(text.data(), text.data() + text.size(), value);
+            sum += value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("std::from_chars uint64 x1024")
+    {
+        std::uint64_t sum = 0;
+        for (auto& text : texts)
+        {
+            std::uint64_t value = 0;
+            std::from_chars(text.data(), text.data() + text.size(), value);
+            sum += value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("ljh::from_string int32 x1024")
+    {
+        std::int32_t sum = 0;
+        for (auto& text : texts)
+        {
+            std::int32_t value = 0;
+            ljh::from_string(value, text);
+            sum += value;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,47 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/checked_math.hpp>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("checked_math", "[benchmark][checked_math]")
+{
+    std::vector<std::int32_t> values(4096);
+    std::iota(values.begin(), values.end(), -2048);
+
+    BENCHMARK("unchecked sum x4096")
+    {
+        std::int64_t sum = 0;
+        for (auto value : values)
+            sum += value * 3;
+        return sum;
+    };
+
+    BENCHMARK("ckd::add and ckd::mul x4096")
+    {
+        std::int64_t sum      = 0;
+        bool         overflow = false;
+        for (auto value : values)
+        {
+            std::int64_t scaled;
+            overflow |= ljh::ckd::mul(scaled, value, 3);
+            overflow |= ljh::ckd::add(sum, sum, scaled);
+        }
+        return overflow ? 0 : sum;
+    };
+
+    BENCHMARK("checked<int64_t> x4096")
+    {
+        ljh::checked<std::int64_t> sum = 0;
+        for (auto value : values)
+            sum += ljh::checked<std::int64_t>{value} * 3;
+        return sum;
+    };
+}
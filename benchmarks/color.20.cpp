@@ -0,0 +1,53 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/color.hpp>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+TEST_CASE("color", "[benchmark][color]")
+{
+    // One 64x64 tile
+    constexpr std::size_t     pixels = 64 * 64;
+    std::vector<ljh::rgba8>   tile(pixels);
+    std::vector<ljh::hsl_f32> hsl(pixels);
+    std::vector<ljh::rgba8>   back(pixels);
+    for (std::size_t a = 0; a < pixels; a++)
+        tile[a] = {uint8_t(a), uint8_t(a * 7), uint8_t(a * 13), uint8_t(a >> 4)};
+
+    std::vector<uint8_t> r(pixels), g(pixels), b(pixels), alpha(pixels);
+    std::vector<float>   h(pixels), s(pixels), l(pixels), fa(pixels);
+    for (std::size_t a = 0; a < pixels; a++)
+        std::tie(r[a], g[a], b[a], alpha[a]) = std::tie(tile[a].r, tile[a].g, tile[a].b, tile[a].a);
+
+    BENCHMARK("rgb_to_hsl and hsl_to_rgb per pixel x4096")
+    {
+        for (std::size_t a = 0; a < pixels; a++)
+        {
+            auto [ph, ps, pl] = ljh::rgb_to_hsl(tile[a].r, tile[a].g, tile[a].b);
+            auto [pr, pg, pb] = ljh::hsl_to_rgb(ph, ps, pl);
+            back[a]           = {pr, pg, pb, tile[a].a};
+        }
+        return back[pixels - 1].r;
+    };
+
+    BENCHMARK("convert rgba8 -> hsl -> rgba8 x4096")
+    {
+        ljh::convert(tile, hsl);
+        ljh::convert(hsl, back);
+        return back[pixels - 1].r;
+    };
+
+    BENCHMARK("convert planar rgba8 -> hsl -> rgba8 x4096")
+    {
+        ljh::convert(ljh::rgba_planes<uint8_t const>{r, g, b, alpha}, ljh::hsl_planes<float>{h, s, l, fa});
+        ljh::convert(ljh::hsl_planes<float const>{h, s, l, fa}, ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+        return r[pixels - 1];
+    };
+}
@@ -0,0 +1,134 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/coroutine.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    ljh::co::task<int> leaf(int value)
+    {
+        co_return value;
+    }
+
+    ljh::co::task<int> sum_of_leaves(int count)
+    {
+        int sum = 0;
+        for (int a = 0; a < count; a++)
+            sum += co_await leaf(a);
+        co_return sum;
+    }
+
+    ljh::co::task<int> lock_loop(ljh::co::shared_mutex& mutex, int& shared, int count)
+    {
+        for (int a = 0; a < count; a++)
+        {
+            co_await mutex.lock_exclusive();
+            shared++;
+            mutex.unlock_exclusive();
+        }
+        co_return count;
+    }
+
+    template<typename Mutex>
+    ljh::co::task<int> read_loop(Mutex& mutex, int const& shared, int count)
+    {
+        int seen = 0;
+        for (int a = 0; a < count; a++)
+        {
+            co_await mutex.lock_shared();
+            seen += shared;
+            mutex.unlock_shared();
+        }
+        co_return seen;
+    }
+
+    template<typename Mutex>
+    int read_on_threads(unsigned threads, int count)
+    {
+        Mutex                    mutex;
+        int                      shared = 1;
+        std::atomic<int>         seen   = 0;
+        std::vector<std::thread> workers;
+        for (unsigned a = 0; a < threads; a++)
+            workers.emplace_back([&] { seen += read_loop(mutex, shared, count).get(); });
+        for (auto& worker : workers)
+            worker.join();
+        return seen;
+    }
+} // namespace
+
+TEST_CASE("co::task", "[benchmark][coroutine]")
+{
+    BENCHMARK("create and get")
+    {
+        return leaf(1).get();
+    };
+
+    BENCHMARK("co_await 100 tasks")
+    {
+        return sum_of_leaves(100).get();
+    };
+}
+
+TEST_CASE("co::shared_mutex", "[benchmark][coroutine]")
+{
+    constexpr int iterations = 1000;
+
+    BENCHMARK("uncontended lock_exclusive x1000")
+    {
+        ljh::co::shared_mutex mutex;
+        int                   shared = 0;
+        lock_loop(mutex, shared, iterations).get();
+        return shared;
+    };
+
+    std::vector<unsigned> thread_counts{2, 4};
+    if (std::thread::hardware_concurrency() > 4)
+        thread_counts.push_back(std::thread::hardware_concurrency());
+
+    for (unsigned threads : thread_counts)
+    {
+        BENCHMARK(std::to_string(threads) + " threads lock_exclusive x1000 each")
+        {
+            ljh::co::shared_mutex    mutex;
+            int                      shared = 0;
+            std::vector<std::thread> workers;
+            for (unsigned a = 0; a < threads; a++)
+                workers.emplace_back([&] { lock_loop(mutex, shared, iterations).get(); });
+            for (auto& worker : workers)
+                worker.join();
+            return shared;
+        };
+    }
+}
+
+TEST_CASE("co::shared_mutex readers", "[benchmark][coroutine]")
+{
+    constexpr int iterations = 10000;
+
+    std::vector<unsigned> thread_counts{1, 4};
+    if (std::thread::hardware_concurrency() > 4)
+        thread_counts.push_back(std::thread::hardware_concurrency());
+
+    for (unsigned threads : thread_counts)
+    {
+        BENCHMARK(std::to_string(threads) + " threads lock_shared x10000 each, shared_mutex")
+        {
+            return read_on_threads<ljh::co::shared_mutex>(threads, iterations);
+        };
+
+        BENCHMARK(std::to_string(threads) + " threads lock_shared x10000 each, big_reader_shared_mutex")
+        {
+            return read_on_threads<ljh::co::big_reader_shared_mutex>(threads, iterations);
+        };
+    }
+}
@@ -0,0 +1,116 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/expected.hpp>
+#include <string_view>
+#include <system_error>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+namespace
+{
+    enum class digit_errc
+    {
+        success,
+        not_a_digit,
+    };
+} // namespace
+
+template<>
+struct ljh::expected_niche<digit_errc> : ljh::expected_niche_value<digit_errc, digit_errc::success>
+{};
+
+// Every call goes through a volatile function pointer so it can't be inlined, which makes the
+// cost of returning the expected (registers vs memory) part of what is measured.
+namespace
+{
+    template<template<typename, typename> typename Expected, template<typename> typename Unexpected, typename E>
+    struct parser
+    {
+        static Expected<int, E> digit(char c) noexcept
+        {
+            if (c < '0' || c > '9')
+                return Unexpected<E>{E::not_a_digit};
+            return c - '0';
+        }
+
+        static Expected<void, E> check(char c) noexcept
+        {
+            if (c < '0' || c > '9')
+                return Unexpected<E>{E::not_a_digit};
+            return {};
+        }
+
+        static inline Expected<int, E> (*volatile digit_ptr)(char) noexcept  = &digit;
+        static inline Expected<void, E> (*volatile check_ptr)(char) noexcept = &check;
+
+        static int sum(std::string_view text)
+        {
+            int total = 0;
+            for (char c : text)
+                total += digit_ptr(c).value_or(0);
+            return total;
+        }
+
+        static int sum_chained(std::string_view text)
+        {
+            int total = 0;
+            for (char c : text)
+                total += digit_ptr(c).and_then([](int v) { return Expected<int, E>{v * 2}; }).transform([](int v) { return v + 1; }).value_or(0);
+            return total;
+        }
+
+        static int count_valid(std::string_view text)
+        {
+            int total = 0;
+            for (char c : text)
+                total += check_ptr(c).has_value();
+            return total;
+        }
+    };
+
+    using ljh_parser = parser<ljh::expected, ljh::unexpected, digit_errc>;
+#if __cpp_lib_expected >= 202211L
+    using std_parser = parser<std::expected, std::unexpected, digit_errc>;
+#endif
+
+    constexpr std::string_view text = "8675309x42-1234567890 0123456789abcdef9876543210";
+} // namespace
+
+TEST_CASE("expected", "[benchmark][expected]")
+{
+    BENCHMARK("ljh::expected<int, E> return")
+    {
+        return ljh_parser::sum(text);
+    };
+    BENCHMARK("ljh::expected<int, E> and_then/transform")
+    {
+        return ljh_parser::sum_chained(text);
+    };
+    BENCHMARK("ljh::expected<void, E> return (niche)")
+    {
+        return ljh_parser::count_valid(text);
+    };
+
+#if __cpp_lib_expected >= 202211L
+    BENCHMARK("std::expected<int, E> return")
+    {
+        return std_parser::sum(text);
+    };
+    BENCHMARK("std::expected<int, E> and_then/transform")
+    {
+        return std_parser::sum_chained(text);
+    };
+    BENCHMARK("std::expected<void, E> return")
+    {
+        return std_parser::count_valid(text);
+    };
+#endif
+}
@@ -0,0 +1,60 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/memory_mapped_file.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+TEST_CASE("memory_mapped::view", "[benchmark][memory_mapped_file]")
+{
+    constexpr std::size_t size = 16 * 1024 * 1024;
+
+    auto path = std::filesystem::temp_directory_path() / "ljh_benchmark_memory_mapped.bin";
+    {
+        std::vector<char> data(size);
+        for (std::size_t a = 0; a < size; a++)
+            data[a] = char(a * 2654435761u >> 24);
+        std::ofstream{path, std::ios::binary}.write(data.data(), data.size());
+    }
+
+    {
+        ljh::memory_mapped::file file{std::filesystem::path{path}, ljh::memory_mapped::permissions::r};
+        REQUIRE(file.size() == size);
+
+        BENCHMARK("map 16 MiB")
+        {
+            return ljh::memory_mapped::view{file, ljh::memory_mapped::permissions::r, 0, size}.valid();
+        };
+
+        ljh::memory_mapped::view view{file, ljh::memory_mapped::permissions::r, 0, size};
+        REQUIRE(view.valid());
+
+        BENCHMARK("scan 16 MiB")
+        {
+            auto          bytes = view.as<std::uint64_t>();
+            std::uint64_t sum   = 0;
+            for (std::size_t a = 0; a < size / sizeof(std::uint64_t); a++)
+                sum += bytes[a];
+            return sum;
+        };
+
+        BENCHMARK("map and scan 16 MiB")
+        {
+            ljh::memory_mapped::view fresh{file, ljh::memory_mapped::permissions::r, 0, size};
+            auto                     bytes = fresh.as<std::uint64_t>();
+            std::uint64_t            sum   = 0;
+            for (std::size_t a = 0; a < size / sizeof(std::uint64_t); a++)
+                sum += bytes[a];
+            return sum;
+        };
+    }
+
+    std::filesystem::remove(path);
+}
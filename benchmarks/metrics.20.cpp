@@ -0,0 +1,60 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/metrics.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    template<typename F>
+    void on_threads(unsigned count, F const& f)
+    {
+        std::vector<std::thread> threads;
+        for (unsigned a = 0; a < count; a++)
+            threads.emplace_back([&f, a] { f(a); });
+        for (auto& thread : threads)
+            thread.join();
+    }
+} // namespace
+
+TEST_CASE("metrics", "[benchmark][metrics]")
+{
+    auto const threads = std::max(2u, std::thread::hardware_concurrency());
+
+    BENCHMARK("shared std::atomic, all threads x100000")
+    {
+        std::atomic<std::uint64_t> shared{0};
+        on_threads(threads, [&](unsigned) {
+            for (int a = 0; a < 100000; a++)
+                shared.fetch_add(1, std::memory_order_relaxed);
+        });
+        return shared.load();
+    };
+
+    BENCHMARK("metrics::counter, all threads x100000")
+    {
+        ljh::metrics::counter counter;
+        on_threads(threads, [&](unsigned) {
+            for (int a = 0; a < 100000; a++)
+                counter++;
+        });
+        return counter.value();
+    };
+
+    BENCHMARK("metrics::histogram, all threads x100000")
+    {
+        ljh::metrics::histogram histogram;
+        on_threads(threads, [&](unsigned id) {
+            for (std::uint64_t a = 0; a < 100000; a++)
+                histogram.record(a * 7 + id);
+        });
+        return histogram.snapshot().count();
+    };
+}
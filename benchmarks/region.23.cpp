@@ -0,0 +1,53 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "ljh/area/region.hpp"
+#include <vector>
+
+TEST_CASE("region", "[benchmark][region]")
+{
+    // A grid of touching 8x8 tiles, the worst case for merging
+    std::vector<ljh::iregion::value_type> tiles;
+    for (int y = 0; y < 8; y++)
+        for (int x = 0; x < 8; x++)
+            tiles.push_back({x * 8, y * 8, 8, 8});
+
+    // Scattered overlapping rects that split what they hit
+    std::vector<ljh::iregion::rect_type> holes;
+    for (int a = 0; a < 16; a++)
+        holes.push_back({(a * 13) % 60, (a * 29) % 60, 5 + a % 4, 3 + a % 5});
+
+    BENCHMARK("add 64 tiles")
+    {
+        ljh::iregion region;
+        for (auto& tile : tiles)
+            region += tile;
+        return region;
+    };
+
+    ljh::iregion full{{0, 0, 64, 64}};
+
+    BENCHMARK("subtract 16 rects")
+    {
+        auto region = full;
+        for (auto& hole : holes)
+            region -= hole;
+        return region;
+    };
+
+    ljh::iregion scattered;
+    for (auto& hole : holes)
+        scattered += hole;
+
+    BENCHMARK("subtract region")
+    {
+        auto region = full;
+        region -= scattered;
+        return region;
+    };
+}
@@ -0,0 +1,72 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "ljh/smarc/list.hpp"
+#include "ljh/smarc/node.hpp"
+#include "ljh/smarc/ptr.hpp"
+#include "ljh/smarc/ref.hpp"
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct item : ljh::smarc::node<item>
+    {
+        int value = 0;
+    };
+} // namespace
+
+TEST_CASE("smarc::ptr", "[benchmark][smarc]")
+{
+    auto held = ljh::smarc::make_item<item>();
+
+    BENCHMARK("make_item")
+    {
+        return ljh::smarc::make_item<item>();
+    };
+
+    BENCHMARK("copy")
+    {
+        ljh::smarc::ptr<item> copy = held;
+        return copy->value;
+    };
+
+    BENCHMARK("ref lock")
+    {
+        ljh::smarc::ref<item> weak = held;
+        return weak.lock()->value;
+    };
+}
+
+TEST_CASE("smarc::list", "[benchmark][smarc]")
+{
+    ljh::smarc::list<item>             items;
+    std::vector<ljh::smarc::ptr<item>> owners;
+    for (int a = 0; a < 1024; a++)
+    {
+        auto& added = owners.emplace_back(ljh::smarc::make_item<item>());
+        added->value = a;
+        added->insert_after(items.last());
+    }
+
+    BENCHMARK("iterate 1024 items")
+    {
+        int sum = 0;
+        for (auto& i : items)
+            sum += i.value;
+        return sum;
+    };
+
+    BENCHMARK("iterate 1024 items const")
+    {
+        int sum = 0;
+        for (auto& i : std::as_const(items))
+            sum += i.value;
+        return sum;
+    };
+}
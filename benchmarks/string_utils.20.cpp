@@ -0,0 +1,80 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/string_utils.hpp>
+#include <string>
+#include <string_view>
+
+using namespace std::literals;
+
+namespace
+{
+    std::string csv_line()
+    {
+        std::string output;
+        for (int a = 0; a < 256; a++)
+        {
+            if (a != 0)
+                output += ',';
+            output += "  field " + std::to_string(a) + '\t';
+        }
+        return output;
+    }
+} // namespace
+
+TEST_CASE("split", "[benchmark][string_utils]")
+{
+    auto const             line = csv_line();
+    std::string_view const view = line;
+
+    BENCHMARK("split std::string 256 fields")
+    {
+        return ljh::split(line, ',');
+    };
+
+    BENCHMARK("split std::string_view 256 fields")
+    {
+        return ljh::split(view, ',');
+    };
+
+    BENCHMARK("split_lazy 256 fields")
+    {
+        std::size_t total = 0;
+        for (auto field : ljh::split_lazy(view, ','))
+            total += field.size();
+        return total;
+    };
+
+    BENCHMARK("split_lazy and trim_copy 256 fields")
+    {
+        std::size_t total = 0;
+        for (auto field : ljh::split_lazy(view, ','))
+            total += ljh::trim_copy(field).size();
+        return total;
+    };
+}
+
+TEST_CASE("trim", "[benchmark][string_utils]")
+{
+    auto const padded = " \t\r\n  "s + std::string(64, 'x') + "  \t\r\n "s;
+
+    BENCHMARK("trim_copy std::string")
+    {
+        return ljh::trim_copy(padded);
+    };
+
+    BENCHMARK("trim_view std::string")
+    {
+        return ljh::trim_view(padded);
+    };
+
+    BENCHMARK("trim_copy std::string_view")
+    {
+        return ljh::trim_copy(std::string_view{padded});
+    };
+}
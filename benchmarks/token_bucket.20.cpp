@@ -0,0 +1,40 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/token_bucket.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("token_bucket::consume", "[benchmark][token_bucket]")
+{
+    BENCHMARK_ADVANCED("always has tokens")(Catch::Benchmark::Chronometer meter)
+    {
+        ljh::token_bucket bucket{1'000'000, 1'000'000};
+        meter.measure([&] { return bucket.consume(1); });
+    };
+
+    BENCHMARK_ADVANCED("always empty")(Catch::Benchmark::Chronometer meter)
+    {
+        ljh::token_bucket bucket{1, 1};
+        bucket.consume(1);
+        meter.measure([&] { return bucket.consume(1); });
+    };
+
+    BENCHMARK("4 threads x10000 each")
+    {
+        ljh::token_bucket        bucket{1'000'000, 1'000'000};
+        std::vector<std::thread> workers;
+        for (int a = 0; a < 4; a++)
+            workers.emplace_back([&] {
+                for (int b = 0; b < 10000; b++)
+                    bucket.consume(1);
+            });
+        for (auto& worker : workers)
+            worker.join();
+    };
+}
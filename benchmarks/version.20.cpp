@@ -0,0 +1,42 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <ljh/version.hpp>
+#include <string_view>
+
+TEST_CASE("version", "[benchmark][version]")
+{
+    std::string_view const texts[] = {"1", "10.0", "10.0.19045", "10.0.19045.4291", "6.1.7601.65536", "2.40.0-rc1", ".5", "65535.65535.65535.65535"};
+
+    BENCHMARK("from_chars x8")
+    {
+        ljh::version::value_type sum = 0;
+        for (auto text : texts)
+        {
+            ljh::version value;
+            ljh::from_chars(text.data(), text.data() + text.size(), value);
+            sum += value.build();
+        }
+        return sum;
+    };
+
+    ljh::version_range_set set{
+        {{6, 1}, {6, 1, ljh::version::max_value, ljh::version::max_value}},
+        {{10, 0, 10240}, {10, 0, 19045, ljh::version::max_value}},
+        {{10, 0, 22000}, {10, 0, 26100, ljh::version::max_value}},
+    };
+    ljh::version const lookups[] = {{5, 1}, {6, 1, 7601}, {10, 0, 19045, 4291}, {10, 0, 20348}, {10, 0, 22631}, {11}};
+
+    BENCHMARK("version_range_set::contains x6")
+    {
+        int found = 0;
+        for (auto& v : lookups)
+            found += set.contains(v);
+        return found;
+    };
+}
@@ -1,10 +1,9 @@
-
 //          Copyright Jared Irwin 2021-2026
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// case_insensitive_string.hpp - v1.0
+// case_insensitive_string.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++11
@@ -12,19 +11,230 @@
 // ABOUT
 //     Case-insensitive strings
 //
+//     ASCII letters are folded for every character type. Wider character types
+//     also use Unicode simple case folding for the common alphabets (Latin, Greek,
+//     Cyrillic, Armenian, Georgian, Glagolitic, fullwidth and Deseret), one code
+//     unit at a time.
+//
 // USAGE
+//     std::unordered_map<ljh::case_insensitive_string, std::string> headers;
+//     headers["Content-Type"] = "text/plain";
+//     headers.find("content-type"); // found
 //
 // Version History
+//     1.1 Fold 8 bytes at a time in compare, add find, std::hash and Unicode simple case folding
 //     1.0 Inital Version
 
 #pragma once
 #include "cpp_version.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <type_traits>
 #if __cpp_lib_string_view >= 201606L
 #include <string_view>
 #endif
 
+namespace _ljh
+{
+    struct case_fold_range
+    {
+        std::uint32_t first;
+        std::uint32_t last;
+        std::int32_t  delta;
+        std::uint32_t stride;
+    };
+
+    // Simple case folding (CaseFolding.txt status C and S) outside of ASCII, sorted by `first`.
+    // A stride of 2 means only every other code point starting at `first` folds.
+    LJH_CPP17_INLINE_VAR constexpr case_fold_range case_fold_table[] = {
+        {0x00B5,  0x00B5,  775,   1},
+        {0x00C0,  0x00D6,  32,    1},
+        {0x00D8,  0x00DE,  32,    1},
+        {0x0100,  0x012E,  1,     2},
+        {0x0132,  0x0136,  1,     2},
+        {0x0139,  0x0147,  1,     2},
+        {0x014A,  0x0176,  1,     2},
+        {0x0178,  0x0178,  -121,  1},
+        {0x0179,  0x017D,  1,     2},
+        {0x017F,  0x017F,  -268,  1},
+        {0x01C4,  0x01C4,  2,     1},
+        {0x01C5,  0x01C5,  1,     1},
+        {0x01C7,  0x01C7,  2,     1},
+        {0x01C8,  0x01C8,  1,     1},
+        {0x01CA,  0x01CA,  2,     1},
+        {0x01CB,  0x01DB,  1,     2},
+        {0x01DE,  0x01EE,  1,     2},
+        {0x01F1,  0x01F1,  2,     1},
+        {0x01F2,  0x01F4,  1,     2},
+        {0x01F8,  0x021E,  1,     2},
+        {0x0222,  0x0232,  1,     2},
+        {0x0345,  0x0345,  116,   1},
+        {0x0370,  0x0372,  1,     2},
+        {0x0376,  0x0376,  1,     1},
+        {0x037F,  0x037F,  116,   1},
+        {0x0386,  0x0386,  38,    1},
+        {0x0388,  0x038A,  37,    1},
+        {0x038C,  0x038C,  64,    1},
+        {0x038E,  0x038F,  63,    1},
+        {0x0391,  0x03A1,  32,    1},
+        {0x03A3,  0x03AB,  32,    1},
+        {0x03C2,  0x03C2,  1,     1},
+        {0x03CF,  0x03CF,  8,     1},
+        {0x03D0,  0x03D0,  -30,   1},
+        {0x03D1,  0x03D1,  -25,   1},
+        {0x03D5,  0x03D5,  -15,   1},
+        {0x03D6,  0x03D6,  -22,   1},
+        {0x03D8,  0x03EE,  1,     2},
+        {0x03F0,  0x03F0,  -54,   1},
+        {0x03F1,  0x03F1,  -48,   1},
+        {0x03F4,  0x03F4,  -60,   1},
+        {0x03F5,  0x03F5,  -64,   1},
+        {0x03F7,  0x03F7,  1,     1},
+        {0x03F9,  0x03F9,  -7,    1},
+        {0x03FA,  0x03FA,  1,     1},
+        {0x03FD,  0x03FF,  -130,  1},
+        {0x0400,  0x040F,  80,    1},
+        {0x0410,  0x042F,  32,    1},
+        {0x0460,  0x0480,  1,     2},
+        {0x048A,  0x04BE,  1,     2},
+        {0x04C0,  0x04C0,  15,    1},
+        {0x04C1,  0x04CD,  1,     2},
+        {0x04D0,  0x052E,  1,     2},
+        {0x0531,  0x0556,  48,    1},
+        {0x10A0,  0x10C5,  7264,  1},
+        {0x10C7,  0x10C7,  7264,  1},
+        {0x10CD,  0x10CD,  7264,  1},
+        {0x1E00,  0x1E94,  1,     2},
+        {0x1E9B,  0x1E9B,  -58,   1},
+        {0x1E9E,  0x1E9E,  -7615, 1},
+        {0x1EA0,  0x1EFE,  1,     2},
+        {0x1F08,  0x1F0F,  -8,    1},
+        {0x1F18,  0x1F1D,  -8,    1},
+        {0x1F28,  0x1F2F,  -8,    1},
+        {0x1F38,  0x1F3F,  -8,    1},
+        {0x1F48,  0x1F4D,  -8,    1},
+        {0x1F59,  0x1F5F,  -8,    2},
+        {0x1F68,  0x1F6F,  -8,    1},
+        {0x1F88,  0x1F8F,  -8,    1},
+        {0x1F98,  0x1F9F,  -8,    1},
+        {0x1FA8,  0x1FAF,  -8,    1},
+        {0x1FB8,  0x1FB9,  -8,    1},
+        {0x1FBA,  0x1FBB,  -74,   1},
+        {0x1FBC,  0x1FBC,  -9,    1},
+        {0x1FBE,  0x1FBE,  -7173, 1},
+        {0x1FC8,  0x1FCB,  -86,   1},
+        {0x1FCC,  0x1FCC,  -9,    1},
+        {0x1FD8,  0x1FD9,  -8,    1},
+        {0x1FDA,  0x1FDB,  -100,  1},
+        {0x1FE8,  0x1FE9,  -8,    1},
+        {0x1FEA,  0x1FEB,  -112,  1},
+        {0x1FEC,  0x1FEC,  -7,    1},
+        {0x1FF8,  0x1FF9,  -128,  1},
+        {0x1FFA,  0x1FFB,  -126,  1},
+        {0x1FFC,  0x1FFC,  -9,    1},
+        {0x2126,  0x2126,  -7517, 1},
+        {0x212A,  0x212A,  -8383, 1},
+        {0x212B,  0x212B,  -8262, 1},
+        {0x2132,  0x2132,  28,    1},
+        {0x2160,  0x216F,  16,    1},
+        {0x2183,  0x2183,  1,     1},
+        {0x24B6,  0x24CF,  26,    1},
+        {0x2C00,  0x2C2F,  48,    1},
+        {0xFF21,  0xFF3A,  32,    1},
+        {0x10400, 0x10427, 40,    1},
+    };
+
+    constexpr std::uint32_t ascii_upper(std::uint32_t c) noexcept
+    {
+        return ('a' <= c && c <= 'z') ? c - ('a' - 'A') : c;
+    }
+
+    LJH_CPP14_CONSTEXPR std::uint32_t unicode_case_fold(std::uint32_t c) noexcept
+    {
+        std::size_t lo = 0;
+        std::size_t hi = sizeof(case_fold_table) / sizeof(case_fold_table[0]);
+        while (lo < hi)
+        {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (case_fold_table[mid].first <= c)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        if (lo == 0)
+            return c;
+        case_fold_range const& range = case_fold_table[lo - 1];
+        if (c > range.last || (c - range.first) % range.stride != 0)
+            return c;
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(c) + range.delta);
+    }
+
+    // Folds a single code unit. ASCII letters fold to upper case so ordering matches
+    // the original to_upper based traits, everything else folds to lower case.
+    template<typename C>
+    LJH_CPP14_CONSTEXPR std::uint32_t case_fold(C c) noexcept
+    {
+        std::uint32_t u = static_cast<std::uint32_t>(static_cast<typename std::make_unsigned<C>::type>(c));
+        if (u < 0x80 || sizeof(C) == 1)
+            return ascii_upper(u);
+        return ascii_upper(unicode_case_fold(u));
+    }
+
+    template<typename C>
+    LJH_CPP14_CONSTEXPR std::uint64_t load_u64(C const* p) noexcept
+    {
+        std::uint64_t word = 0;
+        for (int a = 0; a < 8; a++)
+            word |= std::uint64_t(static_cast<unsigned char>(p[a])) << (8 * a);
+        return word;
+    }
+
+    // Upper cases every ASCII letter in a word of 8 bytes.
+    constexpr std::uint64_t ascii_upper_swar(std::uint64_t word) noexcept
+    {
+        return word ^ ((((word & 0x7F7F7F7F7F7F7F7F) + 0x0101010101010101 * (0x80 - 'a')) &
+                        ~((word & 0x7F7F7F7F7F7F7F7F) + 0x0101010101010101 * (0x80 - 'z' - 1)) & ~word & 0x8080808080808080) >>
+                       2);
+    }
+
+    constexpr bool has_zero_byte(std::uint64_t word) noexcept
+    {
+        return ((word - 0x0101010101010101) & ~word & 0x8080808080808080) != 0;
+    }
+
+    constexpr std::uint64_t hash_mix(std::uint64_t h) noexcept
+    {
+        return (h ^ (h >> 31)) * 0xBF58476D1CE4E5B9;
+    }
+
+    // Hash of the case folded string, packing folded code units into 64 bit words.
+    template<typename C>
+    LJH_CPP14_CONSTEXPR std::size_t case_insensitive_hash(C const* s, std::size_t count) noexcept
+    {
+        std::uint64_t h = 0x9E3779B97F4A7C15 ^ count;
+        std::size_t   i = 0;
+        LJH_IF_CONSTEXPR (sizeof(C) == 1)
+        {
+            for (; count - i >= 8; i += 8)
+                h = hash_mix(h ^ ascii_upper_swar(load_u64(s + i)));
+        }
+
+        constexpr unsigned shift = sizeof(C) < 4 ? 8 * sizeof(C) : 32;
+        while (i < count)
+        {
+            std::uint64_t word = 0;
+            for (unsigned a = 0; a < 64 && i < count; a += shift, i++)
+                word |= std::uint64_t(case_fold(s[i])) << a;
+            h = hash_mix(h ^ word);
+        }
+        h = hash_mix(h);
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
+} // namespace _ljh
+
 namespace ljh
 {
     LJH_MODULE_STRING_EXPORT template<typename T>
@@ -33,34 +243,57 @@ namespace ljh
     private:
         using base = std::char_traits<T>;
 
-        static constexpr typename base::char_type to_upper(typename base::char_type c)
-        {
-            if ('a' <= c && c <= 'z')
-                return c - ('a' - 'A');
-            return c;
-        }
-
     public:
         static constexpr bool eq(typename base::char_type c1, typename base::char_type c2) noexcept
         {
-            return to_upper(c1) == to_upper(c2);
+            return c1 == c2 || _ljh::case_fold(c1) == _ljh::case_fold(c2);
         }
         static constexpr bool lt(typename base::char_type c1, typename base::char_type c2) noexcept
         {
-            return to_upper(c1) < to_upper(c2);
+            return _ljh::case_fold(c1) < _ljh::case_fold(c2);
         }
 
-        static constexpr int compare(typename base::char_type const* s1, typename base::char_type const* s2, size_t count) noexcept
+        static LJH_CPP14_CONSTEXPR int compare(typename base::char_type const* s1, typename base::char_type const* s2, size_t count) noexcept
         {
-            for (size_t i = 0; i < count; i++)
+            size_t i = 0;
+            LJH_IF_CONSTEXPR (sizeof(typename base::char_type) == 1)
+            {
+                for (; count - i >= 8; i += 8)
+                {
+                    std::uint64_t w1 = _ljh::load_u64(s1 + i);
+                    std::uint64_t w2 = _ljh::load_u64(s2 + i);
+                    if (w1 != w2 && _ljh::ascii_upper_swar(w1) != _ljh::ascii_upper_swar(w2))
+                        break;
+                }
+            }
+            for (; i < count; i++)
             {
-                if (to_upper(s1[i]) < to_upper(s2[i]))
-                    return -1;
-                if (to_upper(s1[i]) > to_upper(s2[i]))
-                    return 1;
+                if (s1[i] == s2[i])
+                    continue;
+                std::uint32_t c1 = _ljh::case_fold(s1[i]);
+                std::uint32_t c2 = _ljh::case_fold(s2[i]);
+                if (c1 != c2)
+                    return c1 < c2 ? -1 : 1;
             }
             return 0;
         }
+
+        static LJH_CPP14_CONSTEXPR typename base::char_type const* find(typename base::char_type const* p, size_t count, typename base::char_type const& ch) noexcept
+        {
+            std::uint32_t folded = _ljh::case_fold(ch);
+            size_t        i      = 0;
+            LJH_IF_CONSTEXPR (sizeof(typename base::char_type) == 1)
+            {
+                std::uint64_t pattern = 0x0101010101010101 * (folded & 0xFF);
+                for (; count - i >= 8; i += 8)
+                    if (_ljh::has_zero_byte(_ljh::ascii_upper_swar(_ljh::load_u64(p + i)) ^ pattern))
+                        break;
+            }
+            for (; i < count; i++)
+                if (_ljh::case_fold(p[i]) == folded)
+                    return p + i;
+            return nullptr;
+        }
     };
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename A = std::allocator<C>>
@@ -90,4 +323,27 @@ namespace ljh
     LJH_MODULE_STRING_EXPORT using u32case_insensitive_string_view = basic_case_insensitive_string_view<char32_t>;
 #endif
 #endif
-} // namespace ljh
\ No newline at end of file
+} // namespace ljh
+
+namespace std
+{
+    template<typename C, typename A>
+    struct hash<ljh::basic_case_insensitive_string<C, A>>
+    {
+        std::size_t operator()(ljh::basic_case_insensitive_string<C, A> const& s) const noexcept
+        {
+            return _ljh::case_insensitive_hash(s.data(), s.size());
+        }
+    };
+
+#if __cpp_lib_string_view >= 201606L
+    template<typename C>
+    struct hash<ljh::basic_case_insensitive_string_view<C>>
+    {
+        std::size_t operator()(ljh::basic_case_insensitive_string_view<C> s) const noexcept
+        {
+            return _ljh::case_insensitive_hash(s.data(), s.size());
+        }
+    };
+#endif
+} // namespace std
@@ -1,13 +1,13 @@
-
 //          Copyright Jared Irwin 2020-2026
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// char_convertions.hpp - v1.1
+// char_convertions.hpp - v1.2
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++14
+// Requires C++17 for floating point parsing
 //
 // ABOUT
 //     Allows convertions from strings to basic types
@@ -17,6 +17,7 @@
 // Version History
 //     1.0 Inital Version
 //     1.1 Fix build error on linux
+//     1.2 Replace pow based parser with from_chars, add error reporting, bases and floats
 
 #pragma once
 
@@ -24,82 +25,237 @@
 #include "type_traits.hpp"
 #include <type_traits>
 #include <string>
-#include <cmath>
+#include <limits>
+#include <system_error>
+#include <cstdint>
 #if __cpp_lib_string_view >= 201606L
 #include <string_view>
 #endif
+#if LJH_CPP_VERSION >= LJH_CPP17_VERSION
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace ljh
+{
+    LJH_MODULE_STRING_EXPORT template<typename _char>
+    struct from_chars_result
+    {
+        _char const* ptr;
+        std::errc    ec;
+    };
+} // namespace ljh
 
 namespace _ljh
 {
+    template<typename _char>
+    constexpr unsigned digit_value(_char c) noexcept
+    {
+        return c >= '0' && c <= '9' ? unsigned(c - '0')
+             : c >= 'a' && c <= 'z' ? unsigned(c - 'a' + 10)
+             : c >= 'A' && c <= 'Z' ? unsigned(c - 'A' + 10)
+                                    : 255u;
+    }
+
+    // Loads 8 bytes as a little endian integer. Compilers fold this into a single load.
+    template<typename _char>
+    constexpr std::uint64_t load_eight(_char const* text) noexcept
+    {
+        std::uint64_t v = 0;
+        for (int a = 0; a < 8; a++)
+            v |= std::uint64_t(static_cast<unsigned char>(text[a])) << (a * 8);
+        return v;
+    }
+
+    constexpr bool is_eight_digits(std::uint64_t v) noexcept
+    {
+        return (((v & 0xF0F0F0F0F0F0F0F0) | (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333);
+    }
+
+    // Converts 8 ascii digits at once, with the first character in the low byte.
+    constexpr std::uint32_t parse_eight_digits(std::uint64_t v) noexcept
+    {
+        v = ((v & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+        v = ((v & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+        return std::uint32_t(((v & 0x0000FFFF0000FFFF) * 42949672960001) >> 32);
+    }
+
     template<typename _conv, typename _char>
-    void from_string(_conv& value, _char* text, size_t size)
+    constexpr ljh::from_chars_result<_char> from_chars(_char const* first, _char const* last, _conv& value, int base) noexcept
     {
-        if (size == 0)
-        {
-            return;
-        }
+        static_assert(sizeof(_conv) <= sizeof(std::uint64_t), "from_chars only supports up to 64 bit integers");
+        using unsigned_t = typename std::make_unsigned<_conv>::type;
+
+        if (base < 2 || base > 36)
+            return {first, std::errc::invalid_argument};
 
-        int a = 0;
+        _char const* p   = first;
+        bool         neg = false;
 
         LJH_IF_CONSTEXPR(std::is_signed<_conv>::value)
         {
-            if (text[0] == '-')
+            if (p != last && *p == '-')
             {
-                a = 1;
+                neg = true;
+                p++;
             }
         }
 
-        for (; a < (int)size; a++)
+        std::uint64_t const limit = neg ? std::uint64_t(std::numeric_limits<_conv>::max()) + 1 : std::uint64_t(std::numeric_limits<_conv>::max());
+
+        _char const* digits_start = p;
+        while (p != last && *p == '0')
+            p++;
+        bool const had_zeros = p != digits_start;
+
+        std::uint64_t acc      = 0;
+        bool          overflow = false;
+        _char const*  start    = p;
+
+        if (base == 10)
         {
-            if (!(text[a] >= '0' && text[a] <= '9'))
+            // 19 decimal digits always fit in 64 bits, so nothing needs checking until then.
+            LJH_IF_CONSTEXPR(sizeof(_char) == 1)
+            {
+                while (last - p >= 8 && (p - start) + 8 <= 19)
+                {
+                    std::uint64_t chunk = load_eight(p);
+                    if (!is_eight_digits(chunk))
+                        break;
+                    acc = acc * 100000000 + parse_eight_digits(chunk);
+                    p += 8;
+                }
+            }
+            while (p != last && *p >= '0' && *p <= '9' && (p - start) < 19)
+                acc = acc * 10 + unsigned(*p++ - '0');
+            while (p != last && *p >= '0' && *p <= '9')
             {
-                break;
+                unsigned d = unsigned(*p++ - '0');
+                if (overflow || acc > (limit - d) / 10)
+                    overflow = true;
+                else
+                    acc = acc * 10 + d;
             }
         }
-        a--;
-
-        for (auto max = a; a > -1; a--)
+        else
         {
-            LJH_IF_CONSTEXPR(std::is_signed<_conv>::value)
+            unsigned d = 0;
+            while (p != last && (d = digit_value(*p)) < unsigned(base))
             {
-                if (text[a] == '-')
-                {
-                    value = -value;
-                    continue;
-                }
+                p++;
+                if (overflow || acc > (limit - d) / unsigned(base))
+                    overflow = true;
+                else
+                    acc = acc * unsigned(base) + d;
             }
-            value += static_cast<_conv>((text[a] - '0') * pow(10, max - a));
         }
+
+        if (p == start && !had_zeros)
+            return {first, std::errc::invalid_argument};
+        if (overflow || acc > limit)
+            return {p, std::errc::result_out_of_range};
+
+        value = neg ? static_cast<_conv>(static_cast<unsigned_t>(0 - acc)) : static_cast<_conv>(acc);
+        return {p, std::errc{}};
+    }
+
+#if __cpp_lib_to_chars >= 201611L
+    inline ljh::from_chars_result<char> from_chars_float(char const* first, char const* last, double& value, std::chars_format fmt) noexcept
+    {
+        auto res = std::from_chars(first, last, value, fmt);
+        return {res.ptr, res.ec};
+    }
+
+    inline ljh::from_chars_result<char> from_chars_float(char const* first, char const* last, float& value, std::chars_format fmt) noexcept
+    {
+        auto res = std::from_chars(first, last, value, fmt);
+        return {res.ptr, res.ec};
+    }
+
+    inline ljh::from_chars_result<char> from_chars_float(char const* first, char const* last, long double& value, std::chars_format fmt) noexcept
+    {
+        auto res = std::from_chars(first, last, value, fmt);
+        return {res.ptr, res.ec};
+    }
+
+    template<typename _float, typename _char>
+    ljh::from_chars_result<_char> from_chars_float(_char const* first, _char const* last, _float& value, std::chars_format fmt)
+    {
+        // Everything a float can be made of is ascii, so narrow that prefix and reuse the char parser.
+        std::string narrow;
+        for (_char const* p = first; p != last && *p > 0 && *p < 0x80; p++)
+            narrow.push_back(char(*p));
+
+        auto res = from_chars_float(narrow.data(), narrow.data() + narrow.size(), value, fmt);
+        return {first + (res.ptr - narrow.data()), res.ec};
+    }
+#endif
+
+    template<typename _conv, typename _char>
+    std::errc from_string(_conv& value, _char const* text, size_t size)
+    {
+        return from_chars(text, text + size, value, 10).ec;
+    }
+
+    template<typename _char>
+    std::errc from_string(bool& value, _char const* text, size_t size)
+    {
+        unsigned char temp = 0;
+        auto          res  = from_chars(text, text + size, temp, 10);
+        if (res.ec == std::errc{})
+            value = temp != 0;
+        return res.ec;
     }
 } // namespace _ljh
 
 namespace ljh
 {
+    // Parses an integer in the given base, following the rules of std::from_chars.
+    // Works with every character type and can be used in constant expressions.
+    LJH_MODULE_STRING_EXPORT template<typename _conv, typename _char>
+    constexpr typename std::enable_if<std::is_integral<_conv>::value && !std::is_same<_conv, bool>::value && is_char_type<_char>::value, from_chars_result<_char>>::type
+    from_chars(_char const* first, _char const* last, _conv& value, int base = 10) noexcept
+    {
+        return _ljh::from_chars(first, last, value, base);
+    }
+
+#if __cpp_lib_to_chars >= 201611L
+    // Parses a float following the rules of std::from_chars.
+    LJH_MODULE_STRING_EXPORT template<typename _conv, typename _char>
+    typename std::enable_if<std::is_floating_point<_conv>::value && is_char_type<_char>::value, from_chars_result<_char>>::type
+    from_chars(_char const* first, _char const* last, _conv& value, std::chars_format fmt = std::chars_format::general)
+    {
+        return _ljh::from_chars_float(first, last, value, fmt);
+    }
+#endif
+
 #if __cpp_lib_string_view >= 201606L
     LJH_MODULE_STRING_EXPORT template<typename _conv, class _char, class _traits = std::char_traits<_char>>
-    typename std::enable_if<std::is_integral<_conv>::value>::type from_string(_conv& value, std::basic_string_view<_char, _traits> text)
+    typename std::enable_if<std::is_integral<_conv>::value, std::errc>::type from_string(_conv& value, std::basic_string_view<_char, _traits> text)
     {
-        _ljh::from_string(value, text.data(), text.size());
+        return _ljh::from_string(value, text.data(), text.size());
     }
 #endif
 
     LJH_MODULE_STRING_EXPORT template<typename _conv, class _char, class _traits = std::char_traits<_char>, class _alloc = std::allocator<_char>>
-    typename std::enable_if<std::is_integral<_conv>::value>::type from_string(_conv& value, std::basic_string<_char, _traits, _alloc> text)
+    typename std::enable_if<std::is_integral<_conv>::value, std::errc>::type from_string(_conv& value, std::basic_string<_char, _traits, _alloc> const& text)
     {
-        _ljh::from_string(value, text.data(), text.size());
+        return _ljh::from_string(value, text.data(), text.size());
     }
 
     LJH_MODULE_STRING_EXPORT template<typename _conv, typename _char, size_t _size>
-    typename std::enable_if<std::is_integral<_conv>::value && is_char_type<std::decay_t<_char>>::value>::type from_string(_conv& value, _char text[_size])
+    typename std::enable_if<std::is_integral<_conv>::value && is_char_type<std::decay_t<_char>>::value, std::errc>::type from_string(_conv& value,
+                                                                                                                                    _char text[_size])
     {
-        _ljh::from_string(value, text, _size);
+        return _ljh::from_string(value, text, _size);
     }
 
     LJH_MODULE_STRING_EXPORT template<typename _conv, typename _char>
-    typename std::enable_if<std::is_integral<_conv>::value && is_char_type<std::decay_t<_char>>::value>::type from_string(_conv& value, _char* text)
+    typename std::enable_if<std::is_integral<_conv>::value && is_char_type<std::decay_t<_char>>::value, std::errc>::type from_string(_conv& value, _char* text)
     {
         _char* curr;
         for (curr = text; *curr != 0; curr++) {}
-        _ljh::from_string(value, text, (curr - text) / sizeof(_char));
+        return _ljh::from_string(value, text, curr - text);
     }
-} // namespace ljh
\ No newline at end of file
+} // namespace ljh
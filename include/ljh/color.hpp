@@ -4,10 +4,11 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// color.hpp - v1.0
+// color.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++11
+// Requires C++20 for the bulk span conversions
 //
 // ABOUT
 //
@@ -15,6 +16,7 @@
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Fix hsl_to_rgb hue thirds, add bulk rgba8/hsl/hsv/linear conversions for interleaved and planar buffers
 
 #pragma once
 #include "cpp_version.hpp"
@@ -22,6 +24,14 @@
 #include <cstdint>
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
+#if LJH_CPP_VERSION > LJH_CPP17_VERSION
+#if __has_include(<span>)
+#include <span>
+#endif
+#endif
 
 namespace ljh
 {
@@ -34,19 +44,19 @@ namespace ljh
     // @param s The saturation
     // @param l The lightness
     // @return tuple of uint8_t
-    LJH_MODULE_MATH_EXPORT [[nodiscard]] auto hsl_to_rgb(double h, double s, double l) -> std::tuple<uint8_t, uint8_t, uint8_t>
+    LJH_MODULE_MATH_EXPORT [[nodiscard]] inline auto hsl_to_rgb(double h, double s, double l) -> std::tuple<uint8_t, uint8_t, uint8_t>
     {
         auto hue_to_rgb = [](double p, double q, double t) {
             if (t < 0)
                 t += 1;
             if (t > 1)
                 t -= 1;
-            if (t < 1 / 6)
+            if (t < 1. / 6)
                 return p + (q - p) * 6 * t;
-            if (t < 1 / 2)
+            if (t < 1. / 2)
                 return q;
-            if (t < 2 / 3)
-                return p + (q - p) * (2 / 3 - t) * 6;
+            if (t < 2. / 3)
+                return p + (q - p) * (2. / 3 - t) * 6;
             return p;
         };
 
@@ -60,9 +70,9 @@ namespace ljh
         {
             auto q = l < 0.5 ? l * (1 + s) : l + s - l * s;
             auto p = 2 * l - q;
-            r      = hue_to_rgb(p, q, h + 1 / 3);
+            r      = hue_to_rgb(p, q, h + 1. / 3);
             g      = hue_to_rgb(p, q, h);
-            b      = hue_to_rgb(p, q, h - 1 / 3);
+            b      = hue_to_rgb(p, q, h - 1. / 3);
         }
 
         return std::make_tuple((uint8_t)std::round(r * 255), (uint8_t)std::round(g * 255), (uint8_t)std::round(b * 255));
@@ -77,7 +87,7 @@ namespace ljh
     // @param g The green color value
     // @param b The blue color value
     // @return tuple of doubles
-    LJH_MODULE_MATH_EXPORT [[nodiscard]] auto rgb_to_hsl(uint8_t r, uint8_t g, uint8_t b) -> std::tuple<double, double, double>
+    LJH_MODULE_MATH_EXPORT [[nodiscard]] inline auto rgb_to_hsl(uint8_t r, uint8_t g, uint8_t b) -> std::tuple<double, double, double>
     {
         double dr = r / 255.;
         double dg = g / 255.;
@@ -110,4 +120,372 @@ namespace ljh
 
         return std::make_tuple(h, s, l);
     }
-} // namespace ljh
\ No newline at end of file
+
+    // 8 bit per channel sRGB color, laid out to match RGBA8 image buffers.
+    LJH_MODULE_MATH_EXPORT struct rgba8
+    {
+        uint8_t r, g, b, a;
+    };
+
+    // Linear light color, all channels in the set [0, 1].
+    LJH_MODULE_MATH_EXPORT struct rgba_f32
+    {
+        float r, g, b, a;
+    };
+
+    // All channels in the set [0, 1]. Alpha is carried through unchanged.
+    LJH_MODULE_MATH_EXPORT struct hsl_f32
+    {
+        float h, s, l, a;
+    };
+
+    // All channels in the set [0, 1]. Alpha is carried through unchanged.
+    LJH_MODULE_MATH_EXPORT struct hsv_f32
+    {
+        float h, s, v, a;
+    };
+
+#if __cpp_lib_span >= 202002L
+    // One span per channel, as in planar image buffers. Every plane has at least r.size() (or h.size()) values.
+    LJH_MODULE_MATH_EXPORT template<typename T>
+    struct rgba_planes
+    {
+        std::span<T> r, g, b, a;
+    };
+
+    LJH_MODULE_MATH_EXPORT template<typename T>
+    struct hsl_planes
+    {
+        std::span<T> h, s, l, a;
+    };
+
+    LJH_MODULE_MATH_EXPORT template<typename T>
+    struct hsv_planes
+    {
+        std::span<T> h, s, v, a;
+    };
+#endif
+
+    // The per pixel kernels below are written without branches on pixel data, so the bulk
+    // loops that call them can be vectorized by the compiler (check with -fopt-info-vec).
+    // Without -ffast-math a ?: around float math becomes a branch the vectorizer gives up
+    // on, so choices are made with min/max, or by multiplying with a 0 or 1 weight, and
+    // divisors are kept away from 0 with max instead of being tested.
+    namespace _color
+    {
+        inline float to_unit(uint8_t v) noexcept
+        {
+            return float(v) * (1.f / 255.f);
+        }
+
+        inline uint8_t to_byte(float v) noexcept
+        {
+            return uint8_t(int(std::min(std::max(v * 255.f + 0.5f, 0.f), 255.f)));
+        }
+
+        inline float nonzero(float v) noexcept
+        {
+            return std::max(v, std::numeric_limits<float>::min());
+        }
+
+        // When d is 0 all channels are equal, which picks the red sector with a 0 numerator
+        inline float hue(float r, float g, float b, float max, float d) noexcept
+        {
+            float is_r   = float(max == r);
+            float is_g   = (1.f - is_r) * float(max == g);
+            float is_b   = 1.f - is_r - is_g;
+            float top    = is_r * (g - b) + is_g * (b - r) + is_b * (r - g);
+            float wrap   = g < b ? 6.f : 0.f;
+            float offset = is_r * wrap + is_g * 2.f + is_b * 4.f;
+            return (top / nonzero(d) + offset) * (1.f / 6.f);
+        }
+
+        inline hsl_f32 rgb_to_hsl(rgba8 in) noexcept
+        {
+            float r = to_unit(in.r);
+            float g = to_unit(in.g);
+            float b = to_unit(in.b);
+
+            float max = std::max(r, std::max(g, b));
+            float min = std::min(r, std::min(g, b));
+            float d   = max - min;
+            float l   = (max + min) * 0.5f;
+            float div = 1.f - std::abs(2.f * l - 1.f);
+
+            // div is only 0 for black and white, where d is 0 too
+            return {hue(r, g, b, max, d), d / nonzero(div), l, to_unit(in.a)};
+        }
+
+        inline hsv_f32 rgb_to_hsv(rgba8 in) noexcept
+        {
+            float r = to_unit(in.r);
+            float g = to_unit(in.g);
+            float b = to_unit(in.b);
+
+            float max = std::max(r, std::max(g, b));
+            float min = std::min(r, std::min(g, b));
+            float d   = max - min;
+
+            return {hue(r, g, b, max, d), d / nonzero(max), max, to_unit(in.a)};
+        }
+
+        // f(n) = l - a * max(-1, min(k - 3, 9 - k, 1)), k = (n + 12h) mod 12
+        // k only goes up to 24, and each of the two periods is -1 over the other one, so
+        // taking the larger of both does the mod 12.
+        inline float hsl_channel(float n, hsl_f32 in, float a) noexcept
+        {
+            float k     = n + in.h * 12.f;
+            float first = std::max(-1.f, std::min(std::min(k - 3.f, 9.f - k), 1.f));
+            float next  = std::max(-1.f, std::min(std::min(k - 15.f, 21.f - k), 1.f));
+            return in.l - a * std::max(first, next);
+        }
+
+        inline rgba8 hsl_to_rgb(hsl_f32 in) noexcept
+        {
+            float a = in.s * std::min(in.l, 1.f - in.l);
+            return {to_byte(hsl_channel(0.f, in, a)), to_byte(hsl_channel(8.f, in, a)), to_byte(hsl_channel(4.f, in, a)), to_byte(in.a)};
+        }
+
+        // f(n) = v - vs * max(0, min(k, 4 - k, 1)), k = (n + 6h) mod 6
+        // Like hsl_channel, k only goes up to 12 and each period is 0 over the other one.
+        inline float hsv_channel(float n, hsv_f32 in) noexcept
+        {
+            float k     = n + in.h * 6.f;
+            float first = std::max(0.f, std::min(std::min(k, 4.f - k), 1.f));
+            float next  = std::max(0.f, std::min(std::min(k - 6.f, 10.f - k), 1.f));
+            return in.v - in.v * in.s * std::max(first, next);
+        }
+
+        inline rgba8 hsv_to_rgb(hsv_f32 in) noexcept
+        {
+            return {to_byte(hsv_channel(5.f, in)), to_byte(hsv_channel(3.f, in)), to_byte(hsv_channel(1.f, in)), to_byte(in.a)};
+        }
+
+        struct srgb_tables
+        {
+            static constexpr std::size_t encode_size = 1 << 14;
+
+            std::array<float, 256>           decode;
+            std::array<uint8_t, encode_size> encode;
+
+            srgb_tables() noexcept
+            {
+                for (std::size_t a = 0; a < decode.size(); a++)
+                {
+                    double c  = a / 255.;
+                    decode[a] = float(c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+                }
+                for (std::size_t a = 0; a < encode.size(); a++)
+                {
+                    double c  = a / double(encode_size - 1);
+                    c         = c <= 0.0031308 ? c * 12.92 : 1.055 * std::pow(c, 1 / 2.4) - 0.055;
+                    encode[a] = uint8_t(c * 255. + 0.5);
+                }
+            }
+
+            uint8_t to_srgb(float v) const noexcept
+            {
+                v = v < 0.f ? 0.f : v;
+                v = v > 1.f ? 1.f : v;
+                return encode[std::size_t(v * float(encode_size - 1) + 0.5f)];
+            }
+        };
+
+        inline srgb_tables const& get_srgb_tables() noexcept
+        {
+            static srgb_tables const tables;
+            return tables;
+        }
+
+        // Exact round(c * a / 255) without a division.
+        inline uint8_t premultiply(unsigned c, unsigned a) noexcept
+        {
+            unsigned t = c * a + 128;
+            return uint8_t((t + (t >> 8)) >> 8);
+        }
+
+        inline uint8_t unpremultiply(unsigned c, unsigned a) noexcept
+        {
+            return a == 0 ? uint8_t(0) : uint8_t(std::min(255u, (c * 255 + a / 2) / (a == 0 ? 1 : a)));
+        }
+    } // namespace _color
+
+    // Decodes an sRGB encoded channel to linear light using a lookup table.
+    LJH_MODULE_MATH_EXPORT [[nodiscard]] inline float srgb_to_linear(uint8_t value) noexcept
+    {
+        return _color::get_srgb_tables().decode[value];
+    }
+
+    // Encodes a linear light channel in the set [0, 1] to sRGB using a lookup table.
+    LJH_MODULE_MATH_EXPORT [[nodiscard]] inline uint8_t linear_to_srgb(float value) noexcept
+    {
+        return _color::get_srgb_tables().to_srgb(value);
+    }
+
+#if __cpp_lib_span >= 202002L
+    LJH_MODULE_MATH_EXPORT inline void convert(std::span<rgba8 const> in, std::span<hsl_f32> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = _color::rgb_to_hsl(in[a]);
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(std::span<hsl_f32 const> in, std::span<rgba8> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = _color::hsl_to_rgb(in[a]);
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(std::span<rgba8 const> in, std::span<hsv_f32> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = _color::rgb_to_hsv(in[a]);
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(std::span<hsv_f32 const> in, std::span<rgba8> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = _color::hsv_to_rgb(in[a]);
+    }
+
+    // Decodes sRGB pixels to linear light. Alpha is already linear and is only rescaled.
+    LJH_MODULE_MATH_EXPORT inline void srgb_to_linear(std::span<rgba8 const> in, std::span<rgba_f32> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        auto const& decode = _color::get_srgb_tables().decode;
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = {decode[in[a].r], decode[in[a].g], decode[in[a].b], _color::to_unit(in[a].a)};
+    }
+
+    // Encodes linear light pixels to sRGB. Alpha is already linear and is only rescaled.
+    LJH_MODULE_MATH_EXPORT inline void linear_to_srgb(std::span<rgba_f32 const> in, std::span<rgba8> out) noexcept
+    {
+        assert(out.size() >= in.size());
+        auto const& tables = _color::get_srgb_tables();
+        for (std::size_t a = 0; a < in.size(); a++)
+            out[a] = {tables.to_srgb(in[a].r), tables.to_srgb(in[a].g), tables.to_srgb(in[a].b), _color::to_byte(in[a].a)};
+    }
+
+    // Multiplies the color channels by alpha in place, rounding to nearest.
+    LJH_MODULE_MATH_EXPORT inline void premultiply_alpha(std::span<rgba8> pixels) noexcept
+    {
+        for (auto& p : pixels)
+            p = {_color::premultiply(p.r, p.a), _color::premultiply(p.g, p.a), _color::premultiply(p.b, p.a), p.a};
+    }
+
+    // Divides the color channels by alpha in place. Fully transparent pixels become black.
+    LJH_MODULE_MATH_EXPORT inline void unpremultiply_alpha(std::span<rgba8> pixels) noexcept
+    {
+        for (auto& p : pixels)
+            p = {_color::unpremultiply(p.r, p.a), _color::unpremultiply(p.g, p.a), _color::unpremultiply(p.b, p.a), p.a};
+    }
+
+    namespace _color
+    {
+        template<typename T>
+        std::array<std::span<T>, 4> channels(rgba_planes<T> const& planes) noexcept
+        {
+            return {planes.r, planes.g, planes.b, planes.a};
+        }
+
+        template<typename T>
+        std::array<std::span<T>, 4> channels(hsl_planes<T> const& planes) noexcept
+        {
+            return {planes.h, planes.s, planes.l, planes.a};
+        }
+
+        template<typename T>
+        std::array<std::span<T>, 4> channels(hsv_planes<T> const& planes) noexcept
+        {
+            return {planes.h, planes.s, planes.v, planes.a};
+        }
+
+        // Runs `kernel` over the planes a block of pixels at a time, gathered into and scattered
+        // back out of interleaved buffers on the stack. Indexing four or eight planes directly
+        // needs more overlap checks between them than the vectorizer is willing to add, the
+        // stack buffers can't overlap anything so all three loops vectorize.
+        template<typename InPixel, typename OutPixel, typename In, typename Out, typename Kernel>
+        void planar(In const& in, Out const& out, Kernel&& kernel) noexcept
+        {
+            constexpr std::size_t block = 64;
+
+            auto from = channels(in);
+            auto to   = channels(out);
+            for (auto& plane : from)
+                assert(plane.size() >= from[0].size());
+            for (auto& plane : to)
+                assert(plane.size() >= from[0].size());
+
+            std::array<InPixel, block>  gathered;
+            std::array<OutPixel, block> converted;
+            for (std::size_t start = 0; start < from[0].size(); start += block)
+            {
+                std::size_t count = std::min(block, from[0].size() - start);
+                for (std::size_t a = 0; a < count; a++)
+                    gathered[a] = {from[0][start + a], from[1][start + a], from[2][start + a], from[3][start + a]};
+
+                kernel(std::span<InPixel const>{gathered.data(), count}, std::span<OutPixel>{converted.data(), count});
+
+                for (std::size_t a = 0; a < count; a++)
+                {
+                    auto [c0, c1, c2, c3] = converted[a];
+                    to[0][start + a]      = c0;
+                    to[1][start + a]      = c1;
+                    to[2][start + a]      = c2;
+                    to[3][start + a]      = c3;
+                }
+            }
+        }
+    } // namespace _color
+
+    // Planar versions of the conversions above, every plane holds at least as many values as the first input plane.
+    LJH_MODULE_MATH_EXPORT inline void convert(rgba_planes<uint8_t const> in, hsl_planes<float> out) noexcept
+    {
+        _color::planar<rgba8, hsl_f32>(in, out, [](std::span<rgba8 const> i, std::span<hsl_f32> o) { convert(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(hsl_planes<float const> in, rgba_planes<uint8_t> out) noexcept
+    {
+        _color::planar<hsl_f32, rgba8>(in, out, [](std::span<hsl_f32 const> i, std::span<rgba8> o) { convert(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(rgba_planes<uint8_t const> in, hsv_planes<float> out) noexcept
+    {
+        _color::planar<rgba8, hsv_f32>(in, out, [](std::span<rgba8 const> i, std::span<hsv_f32> o) { convert(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void convert(hsv_planes<float const> in, rgba_planes<uint8_t> out) noexcept
+    {
+        _color::planar<hsv_f32, rgba8>(in, out, [](std::span<hsv_f32 const> i, std::span<rgba8> o) { convert(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void srgb_to_linear(rgba_planes<uint8_t const> in, rgba_planes<float> out) noexcept
+    {
+        _color::planar<rgba8, rgba_f32>(in, out, [](std::span<rgba8 const> i, std::span<rgba_f32> o) { srgb_to_linear(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void linear_to_srgb(rgba_planes<float const> in, rgba_planes<uint8_t> out) noexcept
+    {
+        _color::planar<rgba_f32, rgba8>(in, out, [](std::span<rgba_f32 const> i, std::span<rgba8> o) { linear_to_srgb(i, o); });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void premultiply_alpha(rgba_planes<uint8_t> pixels) noexcept
+    {
+        _color::planar<rgba8, rgba8>(pixels, pixels, [](std::span<rgba8 const> i, std::span<rgba8> o) {
+            std::copy(i.begin(), i.end(), o.begin());
+            premultiply_alpha(o);
+        });
+    }
+
+    LJH_MODULE_MATH_EXPORT inline void unpremultiply_alpha(rgba_planes<uint8_t> pixels) noexcept
+    {
+        _color::planar<rgba8, rgba8>(pixels, pixels, [](std::span<rgba8 const> i, std::span<rgba8> o) {
+            std::copy(i.begin(), i.end(), o.begin());
+            unpremultiply_alpha(o);
+        });
+    }
+#endif
+} // namespace ljh
\ No newline at end of file
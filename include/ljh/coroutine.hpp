@@ -4,7 +4,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// coroutine.hpp - v1.0
+// coroutine.hpp - v1.4
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++20
@@ -15,6 +15,10 @@
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add coroutine/trace.hpp
+//     1.2 Add semaphore, latch, barrier, manual_reset_event and auto_reset_event
+//     1.3 shared_mutex is now basic_shared_mutex with a policy, try_lock, guards and upgrades
+//     1.4 Add big_reader_shared_mutex
 
 #pragma once
 #include "cpp_version.hpp"
@@ -23,8 +27,14 @@
 #include "coroutine/invoke_lambda.hpp"
 #include "coroutine/fire_and_forget.hpp"
 #include "coroutine/shared_mutex.hpp"
+#include "coroutine/big_reader_shared_mutex.hpp"
+#include "coroutine/semaphore.hpp"
+#include "coroutine/latch.hpp"
+#include "coroutine/barrier.hpp"
+#include "coroutine/event.hpp"
 #include "coroutine/task.hpp"
 #include "coroutine/cold_task.hpp"
+#include "coroutine/trace.hpp"
 
 #if defined(LJH_TARGET_Windows)
 #include "coroutine/com_aware_task.hpp"
@@ -0,0 +1,111 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "state.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace ljh::co
+{
+    LJH_MODULE_COROUTINE_EXPORT struct barrier_no_completion
+    {
+        void operator()() noexcept
+        {}
+    };
+
+    template<typename Completion>
+    struct barrier_state;
+
+    template<typename Completion>
+    struct extra_await_data<barrier_state<Completion>>
+    {
+        extra_await_data(std::uint64_t phase)
+            : phase(phase)
+        {}
+        std::uint64_t phase;
+    };
+
+    template<typename Completion>
+    struct barrier_state : state<barrier_state<Completion>>
+    {
+        using typename state<barrier_state<Completion>>::extra_await_data;
+
+        std::atomic<std::uint64_t> phase{0};
+        std::ptrdiff_t             expected;
+        std::ptrdiff_t             remaining;
+        Completion                 completion;
+
+        barrier_state(std::ptrdiff_t expected, Completion completion)
+            : expected(expected)
+            , remaining(expected)
+            , completion(std::move(completion))
+        {}
+
+        bool fast_claim(extra_await_data const& e) const noexcept
+        {
+            return phase.load(std::memory_order::acquire) != e.phase;
+        }
+
+        bool claim(extra_await_data const& e) const noexcept
+        {
+            return fast_claim(e);
+        }
+
+        void arrive(node_list& list, std::ptrdiff_t count, std::ptrdiff_t drop, std::uint64_t* token)
+        {
+            *token = phase.load(std::memory_order::relaxed);
+            expected -= drop;
+            remaining -= count;
+            if (remaining > 0)
+                return;
+            completion();
+            remaining = expected;
+            phase.store(*token + 1, std::memory_order::release);
+            this->resume_all(list);
+        }
+    };
+
+    // Reusable barrier for a fixed number of arrivals per phase. The last arrival of a phase runs
+    // the completion function, while holding the barrier's lock, before anyone is resumed.
+    LJH_MODULE_COROUTINE_EXPORT template<typename Completion = barrier_no_completion>
+    struct barrier : sync_object<barrier_state<Completion>>
+    {
+        using arrival_token = std::uint64_t;
+
+        explicit barrier(std::ptrdiff_t expected, Completion completion = Completion())
+            : sync_object<barrier_state<Completion>>(expected, std::move(completion))
+        {}
+
+        void operator co_await() = delete;
+
+        [[nodiscard]] arrival_token arrive(std::ptrdiff_t count = 1)
+        {
+            arrival_token token;
+            this->action_impl(&barrier_state<Completion>::arrive, count, std::ptrdiff_t{0}, &token);
+            return token;
+        }
+
+        auto wait(arrival_token token)
+        {
+            return this->make_awaiter(token);
+        }
+
+        auto arrive_and_wait()
+        {
+            return wait(arrive());
+        }
+
+        // Arrives for this phase and leaves the barrier for every later one
+        void arrive_and_drop()
+        {
+            arrival_token token;
+            this->action_impl(&barrier_state<Completion>::arrive, std::ptrdiff_t{1}, std::ptrdiff_t{1}, &token);
+        }
+    };
+} // namespace ljh::co
@@ -0,0 +1,206 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../thread_slot.hpp"
+#include "shared_mutex.hpp"
+#include "state.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace ljh::co
+{
+    struct big_reader_shared_mutex_state;
+
+    template<>
+    struct extra_await_data<big_reader_shared_mutex_state>
+    {
+        extra_await_data(bool kind)
+            : exclusive(kind)
+        {}
+        bool exclusive;
+    };
+
+    struct big_reader_shared_mutex_state : state<big_reader_shared_mutex_state>
+    {
+        struct alignas(_ljh::cache_line_size) reader_slot
+        {
+            // A reader can unlock on another thread than it locked on, so only the sum means anything
+            std::atomic<std::ptrdiff_t> count{0};
+        };
+
+        std::size_t                    mask  = _ljh::thread_slot_count() - 1;
+        std::unique_ptr<reader_slot[]> slots = std::make_unique<reader_slot[]>(mask + 1);
+        // The writer at the front of the queue has the flag and is waiting for the readers to leave
+        bool draining = false;
+        // Set while a writer holds the lock or is waiting for the readers to leave
+        alignas(_ljh::cache_line_size) std::atomic<bool> writer{false};
+
+        std::atomic<std::ptrdiff_t>& own_slot() noexcept
+        {
+            return slots[_ljh::thread_slot() & mask].count;
+        }
+
+        // Readers count themselves in before looking for a writer and writers set the flag before
+        // adding up the readers, so one of them always sees the other.
+        bool drained() const noexcept
+        {
+            std::ptrdiff_t total = 0;
+            for (std::size_t a = 0; a <= mask; a++)
+                total += slots[a].count.load(std::memory_order::seq_cst);
+            return total == 0;
+        }
+
+        bool try_lock_shared()
+        {
+            if (writer.load(std::memory_order::relaxed))
+                return false;
+            auto& count = own_slot();
+            count.fetch_add(1, std::memory_order::seq_cst);
+            if (!writer.load(std::memory_order::seq_cst))
+                return true;
+            leave(count);
+            return false;
+        }
+
+        void leave(std::atomic<std::ptrdiff_t>& count)
+        {
+            count.fetch_sub(1, std::memory_order::seq_cst);
+            // The writer might be waiting for this reader
+            if (writer.load(std::memory_order::seq_cst))
+                action_impl(&big_reader_shared_mutex_state::reader_left);
+        }
+
+        bool try_lock_exclusive()
+        {
+            auto expected = false;
+            if (!writer.compare_exchange_strong(expected, true, std::memory_order::seq_cst))
+                return false;
+            if (drained())
+                return true;
+            // Readers may have queued up behind the flag in the meantime
+            action_impl(&big_reader_shared_mutex_state::unlock_exclusive);
+            return false;
+        }
+
+        bool fast_claim(extra_await_data const& e)
+        {
+            return !e.exclusive && try_lock_shared();
+        }
+
+        bool claim(extra_await_data const& e) noexcept
+        {
+            if (!e.exclusive)
+            {
+                // Holding the lock, so no waiting writer can miss the count going up and down again
+                auto& count = own_slot();
+                count.fetch_add(1, std::memory_order::seq_cst);
+                if (!writer.load(std::memory_order::seq_cst))
+                    return true;
+                count.fetch_sub(1, std::memory_order::relaxed);
+                return false;
+            }
+
+            auto expected = false;
+            if (!writer.compare_exchange_strong(expected, true, std::memory_order::seq_cst))
+                return false;
+            if (drained())
+                return true;
+            draining = true;
+            return false;
+        }
+
+        void reader_left(node_list& list)
+        {
+            if (!draining || !drained())
+                return;
+            draining = false;
+            resume_first(list, [](extra_await_data const& e) { return e.exclusive; });
+        }
+
+        void unlock_exclusive(node_list& list)
+        {
+            writer.store(false, std::memory_order::seq_cst);
+
+            // Readers that waited behind this writer go before the next one
+            if (auto readers = resume_if(list, [](extra_await_data const& e) { return !e.exclusive; }))
+                own_slot().fetch_add(static_cast<std::ptrdiff_t>(readers), std::memory_order::seq_cst);
+
+            if (!any_waiters())
+                return;
+            writer.store(true, std::memory_order::seq_cst);
+            if (drained())
+                resume_one(list);
+            else
+                draining = true;
+        }
+    };
+
+    // A shared mutex for data that is read all the time and rarely written. Each thread slot counts
+    // its readers on a cache line of its own, so readers on different threads never write to the same
+    // line. Writers set a flag that keeps new readers out and then wait for the counts to add up to
+    // zero. Queued readers go after the writer they waited on and before the next one.
+    LJH_MODULE_COROUTINE_EXPORT struct big_reader_shared_mutex : sync_object<big_reader_shared_mutex_state>
+    {
+    private:
+        template<typename Guard>
+        struct guard_awaiter : awaiter
+        {
+            big_reader_shared_mutex& mutex;
+
+            Guard await_resume()
+            {
+                awaiter::await_resume();
+                return Guard(mutex, std::adopt_lock);
+            }
+        };
+
+    public:
+        void operator co_await() = delete;
+
+        auto lock_shared()
+        {
+            return make_awaiter(false);
+        }
+        auto lock_exclusive()
+        {
+            return make_awaiter(true);
+        }
+
+        bool try_lock_shared()
+        {
+            return get_state().try_lock_shared();
+        }
+        bool try_lock_exclusive()
+        {
+            return get_state().try_lock_exclusive();
+        }
+
+        void unlock_shared()
+        {
+            get_state().leave(get_state().own_slot());
+        }
+        void unlock_exclusive()
+        {
+            action_impl(&state::unlock_exclusive);
+        }
+
+        using shared_guard    = lock_guard<big_reader_shared_mutex, &big_reader_shared_mutex::unlock_shared>;
+        using exclusive_guard = lock_guard<big_reader_shared_mutex, &big_reader_shared_mutex::unlock_exclusive>;
+
+        // co_await gives a guard that unlocks when it is destroyed
+        auto scoped_lock_shared()
+        {
+            return guard_awaiter<shared_guard>{{get_state(), false}, *this};
+        }
+        auto scoped_lock_exclusive()
+        {
+            return guard_awaiter<exclusive_guard>{{get_state(), true}, *this};
+        }
+    };
+} // namespace ljh::co
@@ -0,0 +1,121 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "state.hpp"
+#include <atomic>
+
+namespace ljh::co
+{
+    struct manual_reset_event_state : state<manual_reset_event_state>
+    {
+        std::atomic<bool> is_set;
+
+        manual_reset_event_state(bool initial = false)
+            : is_set(initial)
+        {}
+
+        bool fast_claim(extra_await_data const&) const noexcept
+        {
+            return is_set.load(std::memory_order::acquire);
+        }
+
+        bool claim(extra_await_data const& e) const noexcept
+        {
+            return fast_claim(e);
+        }
+
+        void set(node_list& list)
+        {
+            is_set.store(true, std::memory_order::release);
+            resume_all(list);
+        }
+    };
+
+    struct auto_reset_event_state : state<auto_reset_event_state>
+    {
+        std::atomic<bool> is_set;
+
+        auto_reset_event_state(bool initial = false)
+            : is_set(initial)
+        {}
+
+        static bool take_transition(bool current, bool& future) noexcept
+        {
+            if (!current)
+                return false;
+            future = false;
+            return true;
+        }
+
+        bool fast_claim(extra_await_data const&) noexcept
+        {
+            if (any_waiters())
+                return false;
+            return calc_claim<true>(is_set, take_transition);
+        }
+
+        bool claim(extra_await_data const&) noexcept
+        {
+            if (any_waiters())
+                return false;
+            return calc_claim<false>(is_set, take_transition);
+        }
+
+        void set(node_list& list)
+        {
+            // Hand the signal straight to the first waiter instead of setting it
+            if (!resume_one(list))
+                is_set.store(true, std::memory_order::release);
+        }
+    };
+
+    // Stays set until reset, co_await resumes right away while set
+    LJH_MODULE_COROUTINE_EXPORT struct manual_reset_event : sync_object<manual_reset_event_state>
+    {
+        explicit manual_reset_event(bool initial = false)
+            : sync_object(initial)
+        {}
+
+        void set()
+        {
+            action_impl(&state::set);
+        }
+
+        void reset() noexcept
+        {
+            get_state().is_set.store(false, std::memory_order::relaxed);
+        }
+
+        bool is_set() const noexcept
+        {
+            return get_state().is_set.load(std::memory_order::acquire);
+        }
+    };
+
+    // Each set lets exactly one co_await through, either one already waiting or the next one
+    LJH_MODULE_COROUTINE_EXPORT struct auto_reset_event : sync_object<auto_reset_event_state>
+    {
+        explicit auto_reset_event(bool initial = false)
+            : sync_object(initial)
+        {}
+
+        void set()
+        {
+            action_impl(&state::set);
+        }
+
+        void reset() noexcept
+        {
+            get_state().is_set.store(false, std::memory_order::relaxed);
+        }
+
+        bool is_set() const noexcept
+        {
+            return get_state().is_set.load(std::memory_order::acquire);
+        }
+    };
+} // namespace ljh::co
@@ -0,0 +1,68 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "state.hpp"
+#include <atomic>
+#include <cstddef>
+
+namespace ljh::co
+{
+    struct latch_state : state<latch_state>
+    {
+        std::atomic<std::ptrdiff_t> remaining;
+
+        latch_state(std::ptrdiff_t expected)
+            : remaining(expected)
+        {}
+
+        bool fast_claim(extra_await_data const&) const noexcept
+        {
+            return remaining.load(std::memory_order::acquire) == 0;
+        }
+
+        bool claim(extra_await_data const& e) const noexcept
+        {
+            return fast_claim(e);
+        }
+
+        void open(node_list& list)
+        {
+            resume_all(list);
+        }
+    };
+
+    // Single use countdown, co_await resumes once it reaches 0
+    LJH_MODULE_COROUTINE_EXPORT struct latch : sync_object<latch_state>
+    {
+        explicit latch(std::ptrdiff_t expected)
+            : sync_object(expected)
+        {}
+
+        void count_down(std::ptrdiff_t count = 1)
+        {
+            // Waiters check and queue under the lock, so taking it after reaching 0 can't miss any
+            if (get_state().remaining.fetch_sub(count, std::memory_order::acq_rel) == count)
+                action_impl(&state::open);
+        }
+
+        bool try_wait() const noexcept
+        {
+            return get_state().fast_claim({});
+        }
+
+        auto wait()
+        {
+            return make_awaiter();
+        }
+
+        auto arrive_and_wait(std::ptrdiff_t count = 1)
+        {
+            count_down(count);
+            return make_awaiter();
+        }
+    };
+} // namespace ljh::co
@@ -74,6 +74,13 @@ namespace ljh::co
             return empty() ? nullptr : next;
         }
 
+        // The node must be in this list
+        void remove_node(_co::node_base& node) noexcept
+        {
+            node.prev->next = node.next;
+            node.next->prev = node.prev;
+        }
+
         _co::node_base* try_remove_head() noexcept
         {
             if (empty())
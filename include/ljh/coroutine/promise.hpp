@@ -7,6 +7,7 @@
 #pragma once
 #include "task_policies.hpp"
 #include "coroutine_headers.hpp"
+#include "trace.hpp"
 
 #include <atomic>
 #include <exception>
@@ -19,6 +20,49 @@ namespace ljh::__::co
     template<typename T>
     struct promise;
 
+#if defined(LJH_CO_TRACE)
+    template<typename U>
+    decltype(auto) get_awaiter(U&& awaitable)
+    {
+        if constexpr (requires { static_cast<U&&>(awaitable).operator co_await(); })
+            return static_cast<U&&>(awaitable).operator co_await();
+        else if constexpr (requires { operator co_await(static_cast<U&&>(awaitable)); })
+            return operator co_await(static_cast<U&&>(awaitable));
+        else
+            return static_cast<U&&>(awaitable);
+    }
+
+    // Wraps whatever a task co_awaits to record when it suspends and resumes, Awaiter is a reference
+    // unless operator co_await made a new one.
+    template<typename Awaiter>
+    struct traced_awaiter
+    {
+        Awaiter awaiter;
+        void*   task = nullptr;
+
+        bool await_ready()
+        {
+            return awaiter.await_ready();
+        }
+
+        template<typename Promise>
+        auto await_suspend(std::coroutine_handle<Promise> handle)
+        {
+            // Once suspended it can be resumed, and even destroyed, on another thread before this returns
+            task = handle.address();
+            LJH_CO_TRACE_EVENT(suspended, task, std::addressof(awaiter));
+            return awaiter.await_suspend(handle);
+        }
+
+        decltype(auto) await_resume()
+        {
+            if (task)
+                LJH_CO_TRACE_EVENT(resumed, task, std::addressof(awaiter));
+            return awaiter.await_resume();
+        }
+    };
+#endif
+
     template<typename T>
     struct promise_value
     {
@@ -156,12 +200,14 @@ namespace ljh::__::co
 
         auto get_return_object() noexcept
         {
+            LJH_CO_TRACE_EVENT(created, as_handle().address(), nullptr);
             return as_promise();
         }
 
         void start()
         {
             m_waiting.store(running_ptr, std::memory_order_relaxed);
+            LJH_CO_TRACE_EVENT(started, as_handle().address(), nullptr);
             as_handle().resume();
         }
 
@@ -198,11 +244,19 @@ namespace ljh::__::co
             return awaiter{{}, m_policies};
         }
 
+#if !defined(LJH_CO_TRACE)
         template<typename U>
         U&& await_transform(U&& awaitable) noexcept
         {
             return static_cast<U&&>(awaitable);
         }
+#else
+        template<typename U>
+        auto await_transform(U&& awaitable)
+        {
+            return traced_awaiter<decltype(get_awaiter(static_cast<U&&>(awaitable)))>{get_awaiter(static_cast<U&&>(awaitable))};
+        }
+#endif
 
 // There is a bug in Clang that makes final_suspend fail to compile.
 // So we are defining a modified versions of ljh's
@@ -215,6 +269,7 @@ namespace ljh::__::co
                 promise_base& self;
                 void          await_suspend(std::coroutine_handle<> /* handle */) const noexcept
                 {
+                    LJH_CO_TRACE_EVENT(completed, self.as_handle().address(), nullptr);
                     auto waiting = self.m_waiting.exchange(reinterpret_cast<void*>(completed_ptr), std::memory_order_acq_rel);
                     if (waiting == reinterpret_cast<void*>(abandoned_ptr))
                         self.destroy();
@@ -230,6 +285,7 @@ namespace ljh::__::co
             promise_base& self;
             void          await_suspend(std::coroutine_handle<>) const noexcept
             {
+                LJH_CO_TRACE_EVENT(completed, self.as_handle().address(), nullptr);
                 auto waiting = self.m_waiting.exchange(reinterpret_cast<void*>(completed_ptr), std::memory_order_acq_rel);
                 if (waiting == reinterpret_cast<void*>(abandoned_ptr))
                     self.destroy();
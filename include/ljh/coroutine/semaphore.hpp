@@ -0,0 +1,99 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "state.hpp"
+#include <atomic>
+#include <cstddef>
+
+namespace ljh::co
+{
+    struct semaphore_state;
+
+    template<>
+    struct extra_await_data<semaphore_state>
+    {
+        extra_await_data(std::ptrdiff_t count = 1)
+            : count(count)
+        {}
+        std::ptrdiff_t count;
+    };
+
+    struct semaphore_state : state<semaphore_state>
+    {
+        std::atomic<std::ptrdiff_t> available;
+
+        semaphore_state(std::ptrdiff_t initial = 0)
+            : available(initial)
+        {}
+
+        static bool acquire_transition(std::ptrdiff_t current, std::ptrdiff_t& future, std::ptrdiff_t&& count) noexcept
+        {
+            if (current < count)
+                return false;
+            future = current - count;
+            return true;
+        }
+
+        bool try_acquire(std::ptrdiff_t count) noexcept
+        {
+            if (!calc_claim<false>(available, available.load(std::memory_order::relaxed), acquire_transition, std::ptrdiff_t{count}))
+                return false;
+            std::atomic_thread_fence(std::memory_order::acquire);
+            return true;
+        }
+
+        // Waiters are served in order, so a big acquire isn't starved by a stream of small ones
+        bool fast_claim(extra_await_data const& e) noexcept
+        {
+            if (any_waiters())
+                return false;
+            return calc_claim<true>(available, available.load(std::memory_order::relaxed), acquire_transition, std::ptrdiff_t{e.count});
+        }
+
+        bool claim(extra_await_data const& e) noexcept
+        {
+            if (any_waiters())
+                return false;
+            return try_acquire(e.count);
+        }
+
+        void release(node_list& list, std::ptrdiff_t count)
+        {
+            available.fetch_add(count, std::memory_order::release);
+            for (auto peek = peek_head(); peek && try_acquire(peek->count); peek = peek_head())
+                resume_one(list);
+        }
+    };
+
+    // Counting semaphore, co_await acquires one
+    LJH_MODULE_COROUTINE_EXPORT struct semaphore : sync_object<semaphore_state>
+    {
+        explicit semaphore(std::ptrdiff_t initial = 0)
+            : sync_object(initial)
+        {}
+
+        auto acquire(std::ptrdiff_t count = 1)
+        {
+            return make_awaiter(count);
+        }
+
+        bool try_acquire(std::ptrdiff_t count = 1) noexcept
+        {
+            return !get_state().any_waiters() && get_state().try_acquire(count);
+        }
+
+        void release(std::ptrdiff_t count = 1)
+        {
+            action_impl(&state::release, count);
+        }
+
+        std::ptrdiff_t available() const noexcept
+        {
+            return get_state().available.load(std::memory_order::relaxed);
+        }
+    };
+} // namespace ljh::co
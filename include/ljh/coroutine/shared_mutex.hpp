@@ -8,131 +8,411 @@
 
 #include "state.hpp"
 #include <atomic>
+#include <cassert>
+#include <mutex>
+#include <utility>
 
 namespace ljh::co
 {
-    struct shared_mutex_state;
+    LJH_MODULE_COROUTINE_EXPORT enum class shared_mutex_policy
+    {
+        // Waiters get the lock in the order they asked for it, with neighbouring readers let in together
+        fifo,
+        // Readers get in whenever no writer holds the lock, a steady stream of them starves writers
+        reader_preferring,
+        // A waiting writer keeps new readers out and goes before any waiting readers
+        writer_preferring,
+        // When both are waiting, every waiting reader gets a turn after each writer and a writer after each group of readers
+        phase_fair,
+    };
+} // namespace ljh::co
+
+namespace ljh::_co
+{
+    enum class shared_lock_kind : unsigned char
+    {
+        shared,
+        upgrade,
+        exclusive,
+        // Swapping an upgrade lock for an exclusive one
+        upgrading,
+    };
+} // namespace ljh::_co
+
+namespace ljh::co
+{
+    template<shared_mutex_policy Policy>
+    struct basic_shared_mutex_state;
 
-    template<>
-    struct extra_await_data<shared_mutex_state>
+    template<shared_mutex_policy Policy>
+    struct extra_await_data<basic_shared_mutex_state<Policy>>
     {
-        extra_await_data(bool kind)
-            : exclusive(kind)
+        extra_await_data(_co::shared_lock_kind kind)
+            : kind(kind)
         {}
-        bool exclusive;
+        _co::shared_lock_kind kind;
     };
 
-    struct shared_mutex_state : state<shared_mutex_state>
+    template<shared_mutex_policy Policy>
+    struct basic_shared_mutex_state : state<basic_shared_mutex_state<Policy>>
     {
-        std::atomic<int> owners;
+        using base = state<basic_shared_mutex_state<Policy>>;
+        using typename base::extra_await_data;
+        using kind = _co::shared_lock_kind;
+
+        // -1 when held exclusively, otherwise 2 for every owner plus 1 if one of them holds the upgrade lock
+        std::atomic<int> owners{0};
+        // Queued writers and upgrades, readers check it without taking the lock
+        std::atomic<int> blocking{0};
+        bool             upgrade_pending = false;
 
-        static bool exclusive_transition(int current, int& future) noexcept
+        static bool transition(int current, int& future, kind&& k) noexcept
         {
-            if (current != 0)
-                return false;
-            future = -1;
-            return true;
+            switch (k)
+            {
+            case kind::shared:
+                if (current < 0)
+                    return false;
+                future = current + 2;
+                return true;
+            case kind::upgrade:
+                if (current < 0 || (current & 1))
+                    return false;
+                future = current + 3;
+                return true;
+            case kind::exclusive:
+                if (current != 0)
+                    return false;
+                future = -1;
+                return true;
+            case kind::upgrading:
+                if (current != 3)
+                    return false;
+                future = -1;
+                return true;
+            }
+            return false;
+        }
+
+        // Whether the policy lets this kind of lock skip past the waiters
+        bool may_claim(kind k) const noexcept
+        {
+            switch (k)
+            {
+            case kind::upgrading: return true;
+            case kind::exclusive: return !this->any_waiters();
+            default:
+                if constexpr (Policy == shared_mutex_policy::reader_preferring)
+                    return true;
+                else if constexpr (Policy == shared_mutex_policy::fifo)
+                    return !this->any_waiters();
+                else
+                    return blocking.load(std::memory_order::relaxed) == 0;
+            }
         }
 
-        static bool shared_transition(int current, int& future) noexcept
+        bool try_claim(kind k) noexcept
         {
-            if (current < 0)
+            if (!may_claim(k) || !this->template calc_claim<false>(owners, owners.load(std::memory_order::relaxed), transition, kind{k}))
                 return false;
-            future = current + 1;
+            std::atomic_thread_fence(std::memory_order::acquire);
             return true;
         }
 
         bool fast_claim(extra_await_data const& e) noexcept
         {
-            if (any_waiters())
+            if (!may_claim(e.kind))
                 return false;
-            if (e.exclusive)
-                return calc_claim<true>(owners, 0, exclusive_transition);
-            else
-                return calc_claim<true>(owners, shared_transition);
+            return this->template calc_claim<true>(owners, owners.load(std::memory_order::relaxed), transition, kind{e.kind});
         }
 
         bool claim(extra_await_data const& e) noexcept
         {
-            if (any_waiters())
-                return false;
-            if (e.exclusive)
-                return calc_claim<false>(owners, exclusive_transition);
-            else
-                return calc_claim<false>(owners, shared_transition);
+            if (may_claim(e.kind) && this->template calc_claim<false>(owners, owners.load(std::memory_order::relaxed), transition, kind{e.kind}))
+                return true;
+            // It is going to be queued
+            if (e.kind == kind::exclusive || e.kind == kind::upgrading)
+                blocking.fetch_add(1, std::memory_order::relaxed);
+            if (e.kind == kind::upgrading)
+                upgrade_pending = true;
+            return false;
+        }
+
+        void unlock_shared(node_list& list)
+        {
+            owners.fetch_sub(2, std::memory_order::release);
+            wake(list, false);
+        }
+
+        void unlock_upgrade(node_list& list)
+        {
+            owners.fetch_sub(3, std::memory_order::release);
+            wake(list, false);
         }
 
         void unlock_exclusive(node_list& list)
         {
-            resume_a_bunch(list);
+            owners.store(0, std::memory_order::release);
+            wake(list, true);
         }
 
-        void unlock_shared(node_list& list)
+        void downgrade_exclusive(node_list& list, kind to)
+        {
+            owners.store(to == kind::upgrade ? 3 : 2, std::memory_order::release);
+            wake(list, true);
+        }
+
+        void downgrade_upgrade(node_list& list)
+        {
+            owners.fetch_sub(1, std::memory_order::release);
+            wake(list, false);
+        }
+
+    private:
+        bool admit(extra_await_data const& e) noexcept
+        {
+            if (!this->template calc_claim<false>(owners, owners.load(std::memory_order::relaxed), transition, kind{e.kind}))
+                return false;
+            if (e.kind == kind::exclusive || e.kind == kind::upgrading)
+                blocking.fetch_sub(1, std::memory_order::relaxed);
+            if (e.kind == kind::upgrading)
+                upgrade_pending = false;
+            return true;
+        }
+
+        void wake(node_list& list, bool after_exclusive)
         {
-            auto current = owners.load(std::memory_order_relaxed);
-            int  future;
-            do
+            if (!this->any_waiters())
+                return;
+
+            // The upgrade already holds part of the lock, so it goes first
+            if (upgrade_pending)
             {
-                if (current == 1)
-                    future = -1;
-                else
-                    future = current - 1;
+                if (this->resume_first(list, [&](extra_await_data const& e) { return e.kind == kind::upgrading && admit(e); }))
+                    return;
+                if constexpr (Policy != shared_mutex_policy::reader_preferring)
+                    return;
             }
-            while (owners.compare_exchange_weak(current, future, std::memory_order_relaxed));
-            if (future == -1)
+
+            auto reader          = [&](extra_await_data const& e) { return (e.kind == kind::shared || e.kind == kind::upgrade) && admit(e); };
+            auto writer          = [&](extra_await_data const& e) { return e.kind == kind::exclusive && admit(e); };
+            auto writers_waiting = blocking.load(std::memory_order::relaxed) > (upgrade_pending ? 1 : 0);
+            auto writer_may_go   = [&] { return writers_waiting && owners.load(std::memory_order::relaxed) == 0; };
+
+            if constexpr (Policy == shared_mutex_policy::fifo)
             {
-                resume_a_bunch(list);
+                for (auto peek = this->peek_head(); peek && peek->kind != kind::upgrading && admit(*peek); peek = this->peek_head())
+                    this->resume_one(list);
             }
-        }
-
-        void resume_a_bunch(node_list& list)
-        {
-            auto count = 0;
-            auto peek  = peek_head();
-            if (!peek)
+            else if constexpr (Policy == shared_mutex_policy::reader_preferring)
             {
-                // nobody to release
+                if (!this->resume_if(list, reader) && writer_may_go())
+                    this->resume_first(list, writer);
             }
-            else if (peek->exclusive)
+            else if constexpr (Policy == shared_mutex_policy::writer_preferring)
             {
-                resume_one(list);
-                count = -1;
+                if (!writers_waiting)
+                    this->resume_if(list, reader);
+                else if (writer_may_go())
+                    this->resume_first(list, writer);
             }
             else
             {
-                do
+                // Readers that waited through a write phase go next, otherwise a writer does
+                if (after_exclusive || !writers_waiting)
+                {
+                    if (!this->resume_if(list, reader) && writer_may_go())
+                        this->resume_first(list, writer);
+                }
+                else if (writer_may_go())
                 {
-                    ++count;
-                    resume_one(list);
-                    peek = peek_head();
+                    this->resume_first(list, writer);
                 }
-                while (peek && !peek->exclusive);
             }
-            owners.store(count, std::memory_order_relaxed);
         }
     };
 
-    LJH_MODULE_COROUTINE_EXPORT struct shared_mutex : sync_object<shared_mutex_state>
+    // Owns a lock adopted from Mutex and gives it back with Unlock
+    LJH_MODULE_COROUTINE_EXPORT template<typename Mutex, void (Mutex::*Unlock)()>
+    class [[nodiscard]] lock_guard
     {
+        Mutex* mutex;
+
+    public:
+        lock_guard(Mutex& mutex, std::adopt_lock_t) noexcept
+            : mutex(std::addressof(mutex))
+        {}
+
+        lock_guard(lock_guard&& other) noexcept
+            : mutex(std::exchange(other.mutex, nullptr))
+        {}
+
+        lock_guard& operator=(lock_guard&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                unlock();
+                mutex = std::exchange(other.mutex, nullptr);
+            }
+            return *this;
+        }
+
+        ~lock_guard()
+        {
+            unlock();
+        }
+
+        void unlock()
+        {
+            if (mutex)
+                (std::exchange(mutex, nullptr)->*Unlock)();
+        }
+
+        // Stops owning the lock without unlocking it
+        Mutex* release() noexcept
+        {
+            return std::exchange(mutex, nullptr);
+        }
+
+        Mutex* get() const noexcept
+        {
+            return mutex;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return mutex != nullptr;
+        }
+    };
+
+    // Besides shared and exclusive, one owner at a time can hold an upgrade lock. It shares with readers
+    // and can later become exclusive without letting a writer in between.
+    LJH_MODULE_COROUTINE_EXPORT template<shared_mutex_policy Policy>
+    struct basic_shared_mutex : sync_object<basic_shared_mutex_state<Policy>>
+    {
+    private:
+        using base = sync_object<basic_shared_mutex_state<Policy>>;
+        using kind = _co::shared_lock_kind;
+
+        template<typename Guard>
+        struct guard_awaiter : base::awaiter
+        {
+            basic_shared_mutex& mutex;
+
+            Guard await_resume()
+            {
+                base::awaiter::await_resume();
+                return Guard(mutex, std::adopt_lock);
+            }
+        };
+
+        template<typename Guard>
+        auto make_guard_awaiter(kind k)
+        {
+            return guard_awaiter<Guard>{{this->get_state(), k}, *this};
+        }
+
+    public:
+        static constexpr shared_mutex_policy policy = Policy;
+
         void operator co_await() = delete;
 
         auto lock_shared()
         {
-            return make_awaiter(false);
+            return this->make_awaiter(kind::shared);
+        }
+        auto lock_upgrade()
+        {
+            return this->make_awaiter(kind::upgrade);
         }
         auto lock_exclusive()
         {
-            return make_awaiter(true);
+            return this->make_awaiter(kind::exclusive);
+        }
+        // Turns the upgrade lock held by the caller into an exclusive lock once the readers leave
+        auto upgrade()
+        {
+            return this->make_awaiter(kind::upgrading);
         }
 
-        void unlock_exclusive()
+        bool try_lock_shared() noexcept
+        {
+            return this->get_state().try_claim(kind::shared);
+        }
+        bool try_lock_upgrade() noexcept
         {
-            action_impl(&state::unlock_exclusive);
+            return this->get_state().try_claim(kind::upgrade);
+        }
+        bool try_lock_exclusive() noexcept
+        {
+            return this->get_state().try_claim(kind::exclusive);
+        }
+        bool try_upgrade() noexcept
+        {
+            return this->get_state().try_claim(kind::upgrading);
         }
 
         void unlock_shared()
         {
-            action_impl(&state::unlock_shared);
+            this->action_impl(&base::state::unlock_shared);
+        }
+        void unlock_upgrade()
+        {
+            this->action_impl(&base::state::unlock_upgrade);
+        }
+        void unlock_exclusive()
+        {
+            this->action_impl(&base::state::unlock_exclusive);
+        }
+
+        void downgrade_to_shared()
+        {
+            this->action_impl(&base::state::downgrade_exclusive, kind::shared);
+        }
+        void downgrade_to_upgrade()
+        {
+            this->action_impl(&base::state::downgrade_exclusive, kind::upgrade);
+        }
+        void downgrade_upgrade_to_shared()
+        {
+            this->action_impl(&base::state::downgrade_upgrade);
+        }
+
+        using shared_guard    = lock_guard<basic_shared_mutex, &basic_shared_mutex::unlock_shared>;
+        using upgrade_guard   = lock_guard<basic_shared_mutex, &basic_shared_mutex::unlock_upgrade>;
+        using exclusive_guard = lock_guard<basic_shared_mutex, &basic_shared_mutex::unlock_exclusive>;
+
+        // co_await gives a guard that unlocks when it is destroyed
+        auto scoped_lock_shared()
+        {
+            return make_guard_awaiter<shared_guard>(kind::shared);
+        }
+        auto scoped_lock_upgrade()
+        {
+            return make_guard_awaiter<upgrade_guard>(kind::upgrade);
+        }
+        auto scoped_lock_exclusive()
+        {
+            return make_guard_awaiter<exclusive_guard>(kind::exclusive);
+        }
+
+        // Takes over the upgrade guard and gives back an exclusive one
+        auto scoped_upgrade(upgrade_guard&& guard)
+        {
+            assert(guard.get() == this);
+            struct awaiter : guard_awaiter<exclusive_guard>
+            {
+                upgrade_guard held;
+
+                exclusive_guard await_resume()
+                {
+                    held.release();
+                    return guard_awaiter<exclusive_guard>::await_resume();
+                }
+            };
+            return awaiter{{{this->get_state(), kind::upgrading}, *this}, std::move(guard)};
         }
     };
+
+    LJH_MODULE_COROUTINE_EXPORT using shared_mutex = basic_shared_mutex<shared_mutex_policy::fifo>;
 } // namespace ljh::co
\ No newline at end of file
@@ -6,9 +6,11 @@
 
 #pragma once
 #include "node_list.hpp"
+#include "trace.hpp"
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <cstddef>
 
 namespace ljh::co
 {
@@ -108,6 +110,41 @@ namespace ljh::co
             return list.append_list(sentinel);
         }
 
+        // Resumes the first waiter, in the order they started waiting, that pred accepts
+        template<typename Pred>
+        bool resume_first(node_list& list, Pred&& pred)
+        {
+            for (auto node = sentinel.next; node != std::addressof(sentinel); node = node->next)
+            {
+                if (pred(extra_node(node)->extra))
+                {
+                    sentinel.remove_node(*node);
+                    list.append_node(*node);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Resumes every waiter that pred accepts, keeping them in order
+        template<typename Pred>
+        std::size_t resume_if(node_list& list, Pred&& pred)
+        {
+            std::size_t count = 0;
+            for (auto node = sentinel.next; node != std::addressof(sentinel);)
+            {
+                auto next = node->next;
+                if (pred(extra_node(node)->extra))
+                {
+                    sentinel.remove_node(*node);
+                    list.append_node(*node);
+                    ++count;
+                }
+                node = next;
+            }
+            return count;
+        }
+
         bool await_suspend(std::coroutine_handle<> handle, _co::node<extra_await_data>& node)
         {
             auto guard = std::lock_guard(mutex);
@@ -115,6 +152,7 @@ namespace ljh::co
                 return false;
             node.handle = handle;
             sentinel.append_node(node);
+            LJH_CO_TRACE_EVENT(wait_begin, handle.address(), this);
             return true;
         }
 
@@ -160,7 +198,9 @@ namespace ljh::co
 
         void resume_node(_co::node_base* node) noexcept
         {
-            extra_node(*node).handle.resume();
+            auto handle = extra_node(*node).handle;
+            LJH_CO_TRACE_EVENT(wait_end, handle.address(), this);
+            handle.resume();
         }
     };
 
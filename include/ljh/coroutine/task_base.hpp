@@ -67,7 +67,7 @@ namespace ljh::__::co
 #if defined(_WIN32)
             WakeByAddressSingle(completed);
 #elif defined(__linux__)
-            syscall(SYS_futex, &completed, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+            syscall(SYS_futex, completed, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
 #endif
         }
     };
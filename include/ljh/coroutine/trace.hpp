@@ -0,0 +1,239 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// Tracing for ljh::co tasks and the waiter lists of co::state, off unless LJH_CO_TRACE is defined.
+//
+// Define LJH_CO_TRACE to record when tasks are created, run, suspend, resume and complete, and when
+// they start and stop waiting on a co::state like co::shared_mutex or token_bucket. Without it the
+// hooks are empty and nothing is recorded. It changes the promise and the waiter lists, so it has to
+// be set for the whole program, not per file; the ljh_CO_TRACE CMake option adds it to everything
+// that links ljh.
+//
+// Each thread writes into its own ring of LJH_CO_TRACE_BUFFER_SIZE records without locking, records
+// that don't fit before the next drain are dropped and counted. write_chrome_trace drains every ring
+// into a JSON file that chrome://tracing and https://ui.perfetto.dev can open. Tasks are identified
+// by the address of their coroutine frame.
+
+#pragma once
+#include "../cpp_version.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#if !defined(LJH_CO_TRACE_BUFFER_SIZE)
+#define LJH_CO_TRACE_BUFFER_SIZE 16384
+#endif
+
+#if defined(LJH_CO_TRACE)
+#define LJH_CO_TRACE_EVENT(what, task, object) ::ljh::co::trace::emit(::ljh::co::trace::event::what, task, object)
+#else
+#define LJH_CO_TRACE_EVENT(what, task, object) ((void)0)
+#endif
+
+namespace ljh::co::trace
+{
+    LJH_MODULE_COROUTINE_EXPORT enum class event : std::uint8_t
+    {
+        created,
+        started,
+        suspended,
+        resumed,
+        completed,
+        wait_begin,
+        wait_end,
+    };
+    inline constexpr std::size_t event_count = 7;
+
+    LJH_MODULE_COROUTINE_EXPORT struct record
+    {
+        std::uint64_t timestamp; // nanoseconds of std::chrono::steady_clock
+        void const*   task;
+        void const*   object;
+        std::uint32_t thread;
+        event         what;
+    };
+
+    LJH_MODULE_COROUTINE_EXPORT struct counters
+    {
+        std::array<std::uint64_t, event_count> events{};
+        std::uint64_t                          dropped = 0;
+
+        std::uint64_t operator[](event what) const noexcept
+        {
+            return events[std::size_t(what)];
+        }
+
+        // Tasks that were created and haven't run to completion yet
+        std::uint64_t in_flight() const noexcept
+        {
+            return (*this)[event::created] - (*this)[event::completed];
+        }
+    };
+
+    namespace _trace
+    {
+        // Only the owning thread moves head and only the drain moves tail
+        struct thread_ring
+        {
+            std::unique_ptr<record[]>                           records{new record[LJH_CO_TRACE_BUFFER_SIZE]};
+            std::atomic<std::uint64_t>                          head{0};
+            std::atomic<std::uint64_t>                          tail{0};
+            std::atomic<std::uint64_t>                          dropped{0};
+            std::array<std::atomic<std::uint64_t>, event_count> counts{};
+            std::atomic<bool>                                   in_use{true};
+            std::uint32_t                                       thread = 0;
+        };
+
+        struct registry
+        {
+            std::mutex                                mutex;
+            std::vector<std::unique_ptr<thread_ring>> rings;
+            std::uint32_t                             next_thread = 0;
+        };
+
+        inline registry& get_registry()
+        {
+            static registry instance;
+            return instance;
+        }
+
+        // Rings outlive their thread so what it recorded can still be written out, new threads reuse them.
+        struct ring_owner
+        {
+            thread_ring* ring;
+
+            ring_owner()
+            {
+                auto& reg   = get_registry();
+                auto  guard = std::lock_guard(reg.mutex);
+                for (auto& existing : reg.rings)
+                {
+                    bool expected = false;
+                    if (existing->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                    {
+                        ring         = existing.get();
+                        ring->thread = reg.next_thread++;
+                        return;
+                    }
+                }
+                ring         = reg.rings.emplace_back(std::make_unique<thread_ring>()).get();
+                ring->thread = reg.next_thread++;
+            }
+
+            ~ring_owner()
+            {
+                ring->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        inline thread_ring& this_thread_ring()
+        {
+            thread_local ring_owner owner;
+            return *owner.ring;
+        }
+
+        inline void write_event(std::ostream& out, bool& first, char const* phase, char const* name, record const& r, bool async)
+        {
+            out << (first ? "\n" : ",\n") << R"({"ph":")" << phase << R"(","name":")" << name << R"(","cat":"ljh.co","pid":1,"tid":)" << r.thread;
+            auto ts = r.timestamp / 1000;
+            out << R"(,"ts":)" << ts << '.' << char('0' + r.timestamp / 100 % 10) << char('0' + r.timestamp / 10 % 10) << char('0' + r.timestamp % 10);
+            if (async)
+                out << R"(,"id":")" << r.task << '"';
+            out << R"(,"args":{"task":")" << r.task << '"';
+            if (r.object)
+                out << R"(,"object":")" << r.object << '"';
+            out << "}}";
+            first = false;
+        }
+
+        inline void write_record(std::ostream& out, bool& first, record const& r)
+        {
+            switch (r.what)
+            {
+            case event::created: write_event(out, first, "b", "task", r, true); break;
+            case event::started: write_event(out, first, "B", "run", r, false); break;
+            case event::suspended:
+                write_event(out, first, "E", "run", r, false);
+                write_event(out, first, "b", "suspended", r, true);
+                break;
+            case event::resumed:
+                write_event(out, first, "e", "suspended", r, true);
+                write_event(out, first, "B", "run", r, false);
+                break;
+            case event::completed:
+                write_event(out, first, "E", "run", r, false);
+                write_event(out, first, "e", "task", r, true);
+                break;
+            case event::wait_begin: write_event(out, first, "b", "wait", r, true); break;
+            case event::wait_end: write_event(out, first, "e", "wait", r, true); break;
+            }
+        }
+    } // namespace _trace
+
+    LJH_MODULE_COROUTINE_EXPORT inline void emit(event what, void const* task, void const* object = nullptr) noexcept
+    {
+        auto& ring = _trace::this_thread_ring();
+        ring.counts[std::size_t(what)].fetch_add(1, std::memory_order_relaxed);
+
+        auto head = ring.head.load(std::memory_order_relaxed);
+        if (head - ring.tail.load(std::memory_order_acquire) >= LJH_CO_TRACE_BUFFER_SIZE)
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        ring.records[head % LJH_CO_TRACE_BUFFER_SIZE] = record{std::uint64_t(now), task, object, ring.thread, what};
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    // Totals from every thread since the start of the program, including dropped records
+    LJH_MODULE_COROUTINE_EXPORT inline counters get_counters()
+    {
+        auto&    reg   = _trace::get_registry();
+        auto     guard = std::lock_guard(reg.mutex);
+        counters total;
+        for (auto& ring : reg.rings)
+        {
+            for (std::size_t a = 0; a < event_count; a++)
+                total.events[a] += ring->counts[a].load(std::memory_order_relaxed);
+            total.dropped += ring->dropped.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // Hands every record not drained yet to callback, a thread at a time, and frees their space
+    LJH_MODULE_COROUTINE_EXPORT template<typename Callback>
+    std::size_t drain(Callback&& callback)
+    {
+        auto&       reg   = _trace::get_registry();
+        auto        guard = std::lock_guard(reg.mutex);
+        std::size_t count = 0;
+        for (auto& ring : reg.rings)
+        {
+            auto tail = ring->tail.load(std::memory_order_relaxed);
+            auto head = ring->head.load(std::memory_order_acquire);
+            for (; tail != head; tail++, count++)
+                callback(ring->records[tail % LJH_CO_TRACE_BUFFER_SIZE]);
+            ring->tail.store(tail, std::memory_order_release);
+        }
+        return count;
+    }
+
+    // Drains everything recorded so far as a Chrome trace event file
+    LJH_MODULE_COROUTINE_EXPORT inline std::size_t write_chrome_trace(std::ostream& out)
+    {
+        bool first = true;
+        out << R"({"displayTimeUnit":"ns","traceEvents":[)";
+        auto count = drain([&](record const& r) { _trace::write_record(out, first, r); });
+        out << "\n]}\n";
+        return count;
+    }
+} // namespace ljh::co::trace
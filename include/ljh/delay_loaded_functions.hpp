@@ -4,7 +4,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// delay_loaded_functions.hpp - v1.0
+// delay_loaded_functions.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++20
@@ -19,8 +19,12 @@
 //    func with the name of the function, and sig with the function
 //    signature (Return type, Calling convection, Parameters)
 //
+//    Functions are looked up on their first call and cached, use
+//    `ljh::delay_load::bind_all(a, b, c)` to look them up ahead of time
+//
 // Version History
 //     1.0 Inital Version
+//     1.1 Cache function pointers and the library handle in atomics, add bind and bind_all
 
 #pragma once
 
@@ -28,6 +32,8 @@
 #include "concepts.hpp"
 #include "os_build_info.hpp"
 #include "function_traits.hpp"
+#include <atomic>
+#include <string_view>
 
 namespace ljh::delay_load
 {
@@ -77,88 +83,140 @@ namespace ljh::delay_load
     LJH_MODULE_OS_EXPORT template<compile_time_string dll_name, compile_time_string function_name, function_type type>
     struct function;
 
+    template<typename dll, auto symbol, function_type type>
+    struct _bound_function;
+
+    // Every resolved function gets one of these so unloading the library can forget its pointer
+    struct _resolved_slot
+    {
+        void (*forget)() noexcept;
+        _resolved_slot* next = nullptr;
+    };
+
     LJH_MODULE_OS_EXPORT template<compile_time_string name>
     class library
     {
-        template<compile_time_string dll_name, compile_time_string function_name, function_type type>
-        friend struct function;
-#if defined(LJH_TARGET_Windows)
-        template<compile_time_string dll_name, uint16_t ordinal_number, function_type type>
-        friend struct ordinal;
-#endif
+        template<typename dll, auto symbol, function_type type>
+        friend struct _bound_function;
 
-        inline static void* dll = nullptr;
+        inline static std::atomic<void*>           dll      = nullptr;
+        inline static std::atomic<_resolved_slot*> resolved = nullptr;
+
+        // Two threads can both open the library, the one that loses keeps the other's handle
+        static void* handle() noexcept
+        {
+            if (auto loaded = dll.load(std::memory_order_acquire))
+                return loaded;
+
+            void* loaded = LOADED_LIB(name.data());
+            if (loaded == nullptr)
+                loaded = LOAD_LIB(name.data());
+            if (loaded == nullptr)
+                return nullptr;
+
+            void* current = nullptr;
+            if (!dll.compare_exchange_strong(current, loaded, std::memory_order_acq_rel))
+            {
+                CLOSE_LIB(loaded);
+                return current;
+            }
+            return loaded;
+        }
 
         static void* function(std::string_view func_name) noexcept
         {
-            if (dll == nullptr)
-                dll = LOADED_LIB(name.data());
-            if (dll == nullptr)
-                dll = LOAD_LIB(name.data());
-            return (void*)(GET_FUNC(dll, func_name.data()));
+            return (void*)(GET_FUNC(handle(), func_name.data()));
         }
 
 #if defined(LJH_TARGET_Windows)
         static void* function(uint16_t func_name) noexcept
         {
-            if (dll == nullptr)
-                dll = LOADED_LIB(name.data());
-            if (dll == nullptr)
-                dll = LOAD_LIB(name.data());
-            return (void*)(GET_FUNC(dll, (_os::LPCSTR)func_name));
+            return (void*)(GET_FUNC(handle(), (_os::LPCSTR)func_name));
         }
 #endif
 
+        static void remember(_resolved_slot& slot) noexcept
+        {
+            slot.next = resolved.load(std::memory_order_relaxed);
+            while (!resolved.compare_exchange_weak(slot.next, &slot, std::memory_order_release, std::memory_order_relaxed))
+                ;
+        }
+
     public:
+        // Can't be called while other threads are calling functions from this library
         static void unload() noexcept
         {
-            while (LOADED_LIB(name.data()))
-                CLOSE_LIB(dll);
-            dll = nullptr;
+            for (auto slot = resolved.exchange(nullptr, std::memory_order_acquire); slot;)
+            {
+                auto next = slot->next;
+                slot->forget();
+                slot = next;
+            }
+            if (dll.load(std::memory_order_relaxed) != nullptr)
+                while (LOADED_LIB(name.data()))
+                    CLOSE_LIB(dll.load(std::memory_order_relaxed));
+            dll.store(nullptr, std::memory_order_release);
         }
     };
 
-    template<compile_time_string dll_name, compile_time_string function_name, function_type type>
-    struct function
+    // The pointer is looked up once and kept in an atomic, so calls after the first are a load
+    // and an indirect call. Lookups are idempotent, threads racing on the first call all find
+    // the same pointer.
+    template<typename dll, auto symbol, function_type type>
+    struct _bound_function
     {
-        using dll    = library<dll_name>;
-        using traits = function_traits<type>;
+        using traits           = function_traits<type>;
+        using function_pointer = typename traits::as::function_pointer;
 
-        template<typename... argument_types>
-        std::enable_if_t<std::is_invocable_v<type, argument_types...>, typename traits::return_type> operator()(argument_types... args) noexcept(
-            traits::is::no_exceptions)
+    private:
+        inline static std::atomic<function_pointer> pointer   = nullptr;
+        inline static std::atomic<bool>             looked_up = false;
+
+        static void forget() noexcept
         {
-            return ((typename traits::as::function_pointer)(dll::function(function_name)))(args...);
+            pointer.store(nullptr, std::memory_order_relaxed);
+            looked_up.store(false, std::memory_order_release);
         }
 
-        bool is_loadable() const noexcept
+        inline static _resolved_slot slot{&forget};
+
+        static function_pointer resolve() noexcept
         {
-            return dll::function(function_name) != nullptr;
+            if (looked_up.load(std::memory_order_acquire))
+                return pointer.load(std::memory_order_acquire);
+
+            auto found = (function_pointer)(dll::function(symbol));
+            pointer.store(found, std::memory_order_release);
+            if (!looked_up.exchange(true, std::memory_order_acq_rel))
+                dll::remember(slot);
+            return found;
         }
 
-        operator bool() const noexcept
+        static function_pointer get() noexcept
         {
-            return is_loadable();
+            auto found = pointer.load(std::memory_order_acquire);
+            if (found == nullptr) [[unlikely]]
+                found = resolve();
+            return found;
         }
-    };
-
-#if defined(LJH_TARGET_Windows)
-    LJH_MODULE_OS_EXPORT template<compile_time_string dll_name, uint16_t ordinal_number, function_type type>
-    struct ordinal
-    {
-        using dll    = library<dll_name>;
-        using traits = function_traits<type>;
 
+    public:
         template<typename... argument_types>
-        std::enable_if_t<std::is_invocable_v<type, argument_types...>, typename traits::return_type> operator()(argument_types... args) noexcept(
+        std::enable_if_t<std::is_invocable_v<type, argument_types...>, typename traits::return_type> operator()(argument_types... args) const noexcept(
             traits::is::no_exceptions)
         {
-            return ((traits::as::function_pointer)(dll::function(ordinal_number)))(args...);
+            return get()(args...);
+        }
+
+        // Looks the function up now instead of on the first call
+        bool bind() const noexcept
+        {
+            return get() != nullptr;
         }
 
         bool is_loadable() const noexcept
         {
-            return dll::function(ordinal_number) != nullptr;
+            return get() != nullptr;
         }
 
         operator bool() const noexcept
@@ -166,9 +224,31 @@ namespace ljh::delay_load
             return is_loadable();
         }
     };
+
+    template<compile_time_string dll_name, compile_time_string function_name, function_type type>
+    struct function : _bound_function<library<dll_name>, function_name, type>
+    {
+        using dll = library<dll_name>;
+    };
+
+#if defined(LJH_TARGET_Windows)
+    LJH_MODULE_OS_EXPORT template<compile_time_string dll_name, uint16_t ordinal_number, function_type type>
+    struct ordinal : _bound_function<library<dll_name>, ordinal_number, type>
+    {
+        using dll = library<dll_name>;
+    };
 #endif
+
+    // Binds all the functions up front, at startup for example, so none of them pay for the
+    // lookup later. Returns whether all of them were found.
+    LJH_MODULE_OS_EXPORT template<typename... functions>
+    bool bind_all(functions const&... to_bind) noexcept
+    {
+        return (true & ... & to_bind.bind());
+    }
 } // namespace ljh::delay_load
 
 #undef LOAD_LIB
 #undef GET_FUNC
-#undef CLOS_LIB
+#undef CLOSE_LIB
+#undef LOADED_LIB
@@ -0,0 +1,91 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// dispatch.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++17
+//
+// ABOUT
+//     Picks between implementations of a function the first time it is called, like an ifunc
+//
+//     `resolver` is called once, on the first call, and the function pointer it returns is
+//     used from then on. Until then the stored pointer is a trampoline that resolves, so every
+//     call is a single indirect call with no checks. Resolvers can run more than once if
+//     several threads make the first call at the same time, so they should always pick the
+//     same implementation.
+//
+// USAGE
+//     static auto pick_sum()
+//     {
+//         return ljh::system_info::has_cpu_features(ljh::system_info::cpu_feature::avx2) ? &sum_avx2 : &sum_scalar;
+//     }
+//     int total = ljh::dispatch<pick_sum>(data, size);
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+
+#include <atomic>
+#include <utility>
+
+namespace _ljh
+{
+    template<auto resolver, typename _function>
+    struct dispatcher;
+
+#define LJH_DISPATCHER(noexcept_)                                                                                                                                  \
+    template<auto resolver, typename R, typename... Args>                                                                                                          \
+    struct dispatcher<resolver, R (*)(Args...) noexcept(noexcept_)>                                                                                                \
+    {                                                                                                                                                              \
+        using type = R (*)(Args...) noexcept(noexcept_);                                                                                                           \
+                                                                                                                                                                   \
+        R operator()(Args... args) const noexcept(noexcept_)                                                                                                       \
+        {                                                                                                                                                          \
+            return _function.load(std::memory_order_acquire)(std::forward<Args>(args)...);                                                                         \
+        }                                                                                                                                                          \
+                                                                                                                                                                   \
+        /* The implementation that will be used, resolving it if needed */                                                                                         \
+        type get() const                                                                                                                                           \
+        {                                                                                                                                                          \
+            auto function = _function.load(std::memory_order_acquire);                                                                                             \
+            return function == &_first_call ? _resolve() : function;                                                                                               \
+        }                                                                                                                                                          \
+                                                                                                                                                                   \
+        /* Calls the resolver again on the next call */                                                                                                            \
+        void reset() const noexcept                                                                                                                                \
+        {                                                                                                                                                          \
+            _function.store(&_first_call, std::memory_order_release);                                                                                              \
+        }                                                                                                                                                          \
+                                                                                                                                                                   \
+    private:                                                                                                                                                       \
+        static type _resolve()                                                                                                                                     \
+        {                                                                                                                                                          \
+            type function = resolver();                                                                                                                            \
+            _function.store(function, std::memory_order_release);                                                                                                  \
+            return function;                                                                                                                                       \
+        }                                                                                                                                                          \
+                                                                                                                                                                   \
+        static R _first_call(Args... args) noexcept(noexcept_)                                                                                                     \
+        {                                                                                                                                                          \
+            return _resolve()(std::forward<Args>(args)...);                                                                                                        \
+        }                                                                                                                                                          \
+                                                                                                                                                                   \
+        static inline std::atomic<type> _function{&_first_call};                                                                                                   \
+    }
+
+    LJH_DISPATCHER(false);
+    LJH_DISPATCHER(true);
+#undef LJH_DISPATCHER
+} // namespace _ljh
+
+namespace ljh
+{
+    // `resolver` is a function or captureless lambda returning a function pointer.
+    LJH_MODULE_MAIN_EXPORT template<auto resolver>
+    inline constexpr _ljh::dispatcher<resolver, decltype(resolver())> dispatch{};
+} // namespace ljh
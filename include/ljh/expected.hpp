@@ -1,33 +1,56 @@
-
 //          Copyright Jared Irwin 2020-2026
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// expected.hpp - v1.0
+// expected.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++17
 //
 // Implements http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0323r7.html
+// and the monadic operations from http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p2505r5.html
 //
 // ABOUT
 //     My version of std::expected
 //     May not be complete or follow the paper correctly
 //
+//     When both T and E are trivially copyable so is the expected, so it can be returned in registers
+//     like std::expected. operator* and operator-> don't check for a value, value() does.
+//
 // USAGE
+//     An error type can give up one of its values to say "there is no error", the expected then
+//     uses that instead of a separate bool whenever it makes it smaller (always for expected<void, E>).
+//     The error type has to be trivially copyable, and that value can't be used as an error anymore.
+//
+//         template<>
+//         struct ljh::expected_niche<my_errc> : ljh::expected_niche_value<my_errc, my_errc::success>
+//         {};
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add and_then, or_else, transform and transform_error; trivial copies; opt-in niche for errors
 
 #pragma once
 
-#include <utility>
+#include <exception>
+#include <functional>
+#include <initializer_list>
 #include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
 #include "cpp_version.hpp"
 #include "type_traits.hpp"
 
+// Only one member of the storage union is ever alive. GCC can lose track of which one once the
+// expected's address escapes, and then warns about reading the other member on the branch that
+// never runs. https://gcc.gnu.org/bugzilla/show_bug.cgi?id=80635
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
 namespace _ljh
 {
     template<bool condition>
@@ -148,132 +171,508 @@ namespace ljh
     template<>
     struct bad_expected_access<void>;
 
-    template<typename T, typename E>
-    struct expected_storage
+    // Specialise to give up a value of E as the "no error" marker
+    LJH_MODULE_MAIN_EXPORT template<typename E>
+    struct expected_niche
+    {};
+
+    LJH_MODULE_MAIN_EXPORT template<typename E, E no_error>
+    struct expected_niche_value
     {
-        struct _A
-        {};
-        using val_t = std::conditional_t<std::is_void_v<T>, _A, T>;
-        using err_t = std::conditional_t<std::is_void_v<E>, _A, E>;
+        static constexpr E value = no_error;
+    };
+} // namespace ljh
 
-        bool has_val;
-        union
+namespace _ljh
+{
+    // Aggregates don't have constructors, fall back to braces for them
+    template<typename V, typename... Args>
+    constexpr V expected_make(Args&&... args)
+    {
+        if constexpr (std::is_constructible_v<V, Args...>)
+            return V(std::forward<Args>(args)...);
+        else
+            return V{std::forward<Args>(args)...};
+    }
+
+    template<typename V, typename... Args>
+    void expected_construct_at(V* where, Args&&... args)
+    {
+        if constexpr (std::is_constructible_v<V, Args...>)
+            ::new (static_cast<void*>(where)) V(std::forward<Args>(args)...);
+        else
+            ::new (static_cast<void*>(where)) V{std::forward<Args>(args)...};
+    }
+
+    // Stands in for the value of expected<void, E>
+    struct expected_empty
+    {
+        friend constexpr bool operator==(expected_empty, expected_empty) noexcept
         {
-            val_t val;
-            err_t unex;
-        };
+            return true;
+        }
+    };
+
+    // Builds the storage from another expected's storage, the same member that is alive in it
+    struct expected_from_t
+    {};
+
+    template<typename Er, typename = void>
+    struct expected_has_niche : std::false_type
+    {};
 
-        template<typename T_ = void, typename = std::enable_if_t<std::is_default_constructible_v<T> || std::is_void_v<T>, T_>>
-        constexpr expected_storage()
-            : has_val(true)
-            , val(val_t{})
+    template<typename Er>
+    struct expected_has_niche<Er, std::void_t<decltype(ljh::expected_niche<Er>::value)>> : std::is_trivially_copyable<Er>
+    {};
+
+    template<typename V, typename Er, bool = std::is_trivially_destructible_v<V> && std::is_trivially_destructible_v<Er>>
+    union expected_variant
+    {
+        expected_empty none;
+        V              val;
+        Er             unex;
+
+        constexpr expected_variant() noexcept
+            : none()
+        {}
+        template<typename... Args>
+        constexpr explicit expected_variant(std::in_place_t, Args&&... args)
+            : val(expected_make<V>(std::forward<Args>(args)...))
         {}
+        template<typename... Args>
+        constexpr explicit expected_variant(ljh::unexpect_t, Args&&... args)
+            : unex(expected_make<Er>(std::forward<Args>(args)...))
+        {}
+        // If making the member throws no member is alive, and nothing above the union gets to destroy one
+        template<typename Src>
+        explicit expected_variant(expected_from_t, Src&& src)
+            : none()
+        {
+            using src_t = std::remove_cv_t<std::remove_reference_t<Src>>;
+            if (src.has_value())
+                expected_construct_at(std::addressof(val), src_t::value_of(std::forward<Src>(src)));
+            else
+                expected_construct_at(std::addressof(unex), src_t::error_of(std::forward<Src>(src)));
+        }
+    };
+
+    template<typename V, typename Er>
+    union expected_variant<V, Er, false>
+    {
+        expected_empty none;
+        V              val;
+        Er             unex;
 
-        constexpr expected_storage(expected_storage const& rhs)
-            : has_val(rhs.has_val)
+        constexpr expected_variant() noexcept
+            : none()
+        {}
+        template<typename... Args>
+        constexpr explicit expected_variant(std::in_place_t, Args&&... args)
+            : val(expected_make<V>(std::forward<Args>(args)...))
+        {}
+        template<typename... Args>
+        constexpr explicit expected_variant(ljh::unexpect_t, Args&&... args)
+            : unex(expected_make<Er>(std::forward<Args>(args)...))
+        {}
+        // If making the member throws no member is alive, and nothing above the union gets to destroy one
+        template<typename Src>
+        explicit expected_variant(expected_from_t, Src&& src)
+            : none()
         {
-            if (rhs.has_val)
-            {
-                val = rhs.val;
-            }
+            using src_t = std::remove_cv_t<std::remove_reference_t<Src>>;
+            if (src.has_value())
+                expected_construct_at(std::addressof(val), src_t::value_of(std::forward<Src>(src)));
             else
-            {
-                unex = rhs.unex;
-            }
+                expected_construct_at(std::addressof(unex), src_t::error_of(std::forward<Src>(src)));
+        }
+        ~expected_variant()
+        {}
+    };
+
+    // Value and error share their storage, a bool says which one is alive.
+    template<typename V, typename Er, bool = std::is_trivially_destructible_v<V> && std::is_trivially_destructible_v<Er>>
+    struct expected_union
+    {
+        expected_variant<V, Er> data;
+        bool                    has_val;
+
+        template<typename Src>
+        explicit expected_union(expected_from_t, Src&& src)
+            : data(expected_from_t{}, std::forward<Src>(src))
+            , has_val(src.has_value())
+        {}
+        template<typename... Args>
+        constexpr explicit expected_union(std::in_place_t, Args&&... args)
+            : data(std::in_place, std::forward<Args>(args)...)
+            , has_val(true)
+        {}
+        template<typename... Args>
+        constexpr explicit expected_union(ljh::unexpect_t, Args&&... args)
+            : data(ljh::unexpect, std::forward<Args>(args)...)
+            , has_val(false)
+        {}
+
+        constexpr bool has_value() const noexcept
+        {
+            return has_val;
+        }
+        template<typename Self>
+        static constexpr decltype(auto) value_of(Self&& self) noexcept
+        {
+            return (std::forward<Self>(self).data.val);
+        }
+        template<typename Self>
+        static constexpr decltype(auto) error_of(Self&& self) noexcept
+        {
+            return (std::forward<Self>(self).data.unex);
         }
 
-        constexpr expected_storage(expected_storage&& rhs) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
-            : has_val(rhs.has_val)
+        template<typename... Args>
+        void construct_value(Args&&... args)
         {
-            if (rhs.has_val)
-            {
-                val = std::move(rhs.val);
-                rhs.val.~val_t();
-            }
+            expected_construct_at(std::addressof(data.val), std::forward<Args>(args)...);
+            has_val = true;
+        }
+        template<typename... Args>
+        void construct_error(Args&&... args)
+        {
+            expected_construct_at(std::addressof(data.unex), std::forward<Args>(args)...);
+            has_val = false;
+        }
+        void destroy() noexcept
+        {
+            if (has_val)
+                data.val.~V();
             else
-            {
-                unex = std::move(rhs.unex);
-                rhs.unex.~err_t();
-            }
+                data.unex.~Er();
+        }
+    };
+
+    template<typename V, typename Er>
+    struct expected_union<V, Er, false> : expected_union<V, Er, true>
+    {
+        using expected_union<V, Er, true>::expected_union;
+        expected_union(expected_union const&)            = default;
+        expected_union(expected_union&&)                 = default;
+        expected_union& operator=(expected_union const&) = default;
+        expected_union& operator=(expected_union&&)      = default;
+        ~expected_union()
+        {
+            this->destroy();
         }
+    };
+
+    template<typename V, bool = std::is_trivially_destructible_v<V>>
+    struct expected_value_slot
+    {
+        union
+        {
+            expected_empty none;
+            V              val;
+        };
 
-        constexpr expected_storage(bool has_val, val_t& rhs) noexcept(std::is_nothrow_copy_constructible_v<val_t>)
-            : has_val(has_val)
-            , val(rhs)
+        constexpr expected_value_slot() noexcept
+            : none()
         {}
+        template<typename... Args>
+        constexpr explicit expected_value_slot(std::in_place_t, Args&&... args)
+            : val(expected_make<V>(std::forward<Args>(args)...))
+        {}
+    };
+
+    template<typename V>
+    struct expected_value_slot<V, false>
+    {
+        union
+        {
+            expected_empty none;
+            V              val;
+        };
 
-        constexpr expected_storage(bool has_val, val_t&& rhs) noexcept(std::is_nothrow_move_constructible_v<val_t>)
-            : has_val(has_val)
-            , val(std::move(rhs))
+        constexpr expected_value_slot() noexcept
+            : none()
         {}
+        template<typename... Args>
+        constexpr explicit expected_value_slot(std::in_place_t, Args&&... args)
+            : val(expected_make<V>(std::forward<Args>(args)...))
+        {}
+        ~expected_value_slot()
+        {}
+    };
 
-        constexpr expected_storage(bool has_val, err_t& rhs, unexpect_t) noexcept(std::is_nothrow_copy_constructible_v<err_t>)
-            : has_val(has_val)
-            , unex(rhs)
+    // Empty so expected<void, E> is only as big as E
+    template<>
+    struct expected_value_slot<expected_empty, true>
+    {
+        constexpr expected_value_slot() noexcept = default;
+        constexpr explicit expected_value_slot(std::in_place_t) noexcept
         {}
+    };
 
-        constexpr expected_storage(bool has_val, err_t&& rhs, unexpect_t) noexcept(std::is_nothrow_move_constructible_v<err_t>)
-            : has_val(has_val)
-            , unex(std::move(rhs))
+    // The error is always alive, holding ljh::expected_niche<Er>::value while there is a value.
+    template<typename V, typename Er, bool = std::is_trivially_destructible_v<V>>
+    struct expected_with_niche : expected_value_slot<V>
+    {
+        static constexpr Er no_error = ljh::expected_niche<Er>::value;
+
+        Er unex;
+
+        // Only marks the value alive once it has been made
+        template<typename Src>
+        explicit expected_with_niche(expected_from_t, Src&& src)
+            : expected_value_slot<V>()
+            , unex(no_error)
+        {
+            using src_t = std::remove_cv_t<std::remove_reference_t<Src>>;
+            if (!src.has_value())
+                unex = expected_make<Er>(src_t::error_of(std::forward<Src>(src)));
+            else if constexpr (!std::is_same_v<V, expected_empty>)
+                expected_construct_at(std::addressof(this->val), src_t::value_of(std::forward<Src>(src)));
+        }
+        template<typename... Args>
+        constexpr explicit expected_with_niche(std::in_place_t, Args&&... args)
+            : expected_value_slot<V>(std::in_place, std::forward<Args>(args)...)
+            , unex(no_error)
+        {}
+        template<typename... Args>
+        constexpr explicit expected_with_niche(ljh::unexpect_t, Args&&... args)
+            : expected_value_slot<V>()
+            , unex(expected_make<Er>(std::forward<Args>(args)...))
         {}
 
-        expected_storage& operator=(expected_storage const& rhs)
+        constexpr bool has_value() const noexcept
         {
-            if (has_val)
-            {
-                val.~val_t();
-            }
-            else
-            {
-                unex.~err_t();
-            }
-            has_val = rhs.has_val;
-            if (rhs.has_val)
-            {
-                val = rhs.val;
-            }
+            return unex == no_error;
+        }
+        template<typename Self>
+        static constexpr decltype(auto) value_of(Self&& self) noexcept
+        {
+            if constexpr (std::is_same_v<V, expected_empty>)
+                return expected_empty{};
             else
-            {
-                unex = rhs.unex;
-            }
-            return *this;
+                return (std::forward<Self>(self).val);
+        }
+        template<typename Self>
+        static constexpr decltype(auto) error_of(Self&& self) noexcept
+        {
+            return (std::forward<Self>(self).unex);
         }
 
-        expected_storage& operator=(expected_storage&& rhs) noexcept
+        template<typename... Args>
+        void construct_value(Args&&... args)
         {
-            if (has_val)
-            {
-                val.~val_t();
-            }
-            else
-            {
-                unex.~err_t();
-            }
-            has_val = rhs.has_val;
-            if (rhs.has_val)
+            if constexpr (!std::is_same_v<V, expected_empty>)
+                expected_construct_at(std::addressof(this->val), std::forward<Args>(args)...);
+            unex = no_error;
+        }
+        template<typename... Args>
+        void construct_error(Args&&... args)
+        {
+            unex = expected_make<Er>(std::forward<Args>(args)...);
+        }
+        void destroy() noexcept
+        {
+            if constexpr (!std::is_same_v<V, expected_empty>)
+                if (has_value())
+                    this->val.~V();
+        }
+    };
+
+    template<typename V, typename Er>
+    struct expected_with_niche<V, Er, false> : expected_with_niche<V, Er, true>
+    {
+        using expected_with_niche<V, Er, true>::expected_with_niche;
+        expected_with_niche(expected_with_niche const&)            = default;
+        expected_with_niche(expected_with_niche&&)                 = default;
+        expected_with_niche& operator=(expected_with_niche const&) = default;
+        expected_with_niche& operator=(expected_with_niche&&)      = default;
+        ~expected_with_niche()
+        {
+            this->destroy();
+        }
+    };
+
+    template<typename V, typename Er, bool = expected_has_niche<Er>::value>
+    struct expected_use_niche : std::bool_constant<(sizeof(expected_with_niche<V, Er>) < sizeof(expected_union<V, Er>))>
+    {};
+
+    template<typename V, typename Er>
+    struct expected_use_niche<V, Er, false> : std::false_type
+    {};
+
+    template<typename V, typename Er>
+    using expected_layout = std::conditional_t<expected_use_niche<V, Er>::value, expected_with_niche<V, Er>, expected_union<V, Er>>;
+
+    // Each of the layers below only writes out its operation when V or Er need more than a copy of
+    // the bytes, otherwise it stays trivial and so does the expected. Types that can't be copied or
+    // moved at all fall through to the defaulted, deleted, operation.
+    template<typename V, typename Er, bool = !(std::is_copy_constructible_v<V> && std::is_copy_constructible_v<Er>) ||
+                                             (std::is_trivially_copy_constructible_v<V> && std::is_trivially_copy_constructible_v<Er>)>
+    struct expected_copy : expected_layout<V, Er>
+    {
+        using expected_layout<V, Er>::expected_layout;
+    };
+
+    template<typename V, typename Er>
+    struct expected_copy<V, Er, false> : expected_layout<V, Er>
+    {
+        using base = expected_layout<V, Er>;
+        using base::base;
+        expected_copy(expected_copy const& rhs)
+            : base(expected_from_t{}, static_cast<base const&>(rhs))
+        {}
+        expected_copy(expected_copy&&)                 = default;
+        expected_copy& operator=(expected_copy const&) = default;
+        expected_copy& operator=(expected_copy&&)      = default;
+    };
+
+    template<typename V, typename Er, bool = !(std::is_move_constructible_v<V> && std::is_move_constructible_v<Er>) ||
+                                             (std::is_trivially_move_constructible_v<V> && std::is_trivially_move_constructible_v<Er>)>
+    struct expected_move : expected_copy<V, Er>
+    {
+        using expected_copy<V, Er>::expected_copy;
+    };
+
+    template<typename V, typename Er>
+    struct expected_move<V, Er, false> : expected_copy<V, Er>
+    {
+        using base = expected_layout<V, Er>;
+        using expected_copy<V, Er>::expected_copy;
+        expected_move(expected_move const&) = default;
+        expected_move(expected_move&& rhs) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_constructible_v<Er>)
+            : expected_copy<V, Er>(expected_from_t{}, static_cast<base&&>(rhs))
+        {}
+        expected_move& operator=(expected_move const&) = default;
+        expected_move& operator=(expected_move&&)      = default;
+    };
+
+    template<bool ToValue, typename Storage, typename... Args>
+    void expected_construct(Storage& storage, Args&&... args)
+    {
+        if constexpr (ToValue)
+            storage.construct_value(std::forward<Args>(args)...);
+        else
+            storage.construct_error(std::forward<Args>(args)...);
+    }
+
+    // Replaces the alive member old with a New made from args, like reinit-expected in P0323. If making
+    // New throws, old is put back, so the storage never ends up without an alive member.
+    template<bool ToValue, typename New, bool FromValue, typename Storage, typename Old, typename... Args>
+    void expected_reinit(Storage& storage, Old&& old, Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible_v<New, Args...>)
+        {
+            storage.destroy();
+            expected_construct<ToValue>(storage, std::forward<Args>(args)...);
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<New>)
+        {
+            auto temp = expected_make<New>(std::forward<Args>(args)...);
+            storage.destroy();
+            expected_construct<ToValue>(storage, std::move(temp));
+        }
+        else
+        {
+            std::remove_cv_t<std::remove_reference_t<Old>> temp(std::move(old));
+            storage.destroy();
+            try
             {
-                val = std::move(rhs.val);
+                expected_construct<ToValue>(storage, std::forward<Args>(args)...);
             }
-            else
+            catch (...)
             {
-                unex = std::move(rhs.unex);
+                expected_construct<FromValue>(storage, std::move(temp));
+                throw;
             }
+        }
+    }
+
+    // Assigns onto the alive member when both sides hold the same one, otherwise switches members
+    template<typename Lhs, typename Rhs>
+    void expected_assign(Lhs& lhs, Rhs&& rhs)
+    {
+        using base = typename Lhs::base;
+        using V    = std::remove_cv_t<std::remove_reference_t<decltype(base::value_of(lhs))>>;
+        using Er   = std::remove_cv_t<std::remove_reference_t<decltype(base::error_of(lhs))>>;
+        if (lhs.has_value() && rhs.has_value())
+            base::value_of(lhs) = base::value_of(std::forward<Rhs>(rhs));
+        else if (!lhs.has_value() && !rhs.has_value())
+            base::error_of(lhs) = base::error_of(std::forward<Rhs>(rhs));
+        else if (rhs.has_value())
+            expected_reinit<true, V, false>(lhs, base::error_of(lhs), base::value_of(std::forward<Rhs>(rhs)));
+        else
+            expected_reinit<false, Er, true>(lhs, base::value_of(lhs), base::error_of(std::forward<Rhs>(rhs)));
+    }
+
+    template<typename V, typename Er>
+    inline constexpr bool expected_trivially_copy_assignable =
+        std::is_trivially_copy_assignable_v<V> && std::is_trivially_copy_constructible_v<V> && std::is_trivially_destructible_v<V> &&
+        std::is_trivially_copy_assignable_v<Er> && std::is_trivially_copy_constructible_v<Er> && std::is_trivially_destructible_v<Er>;
+
+    template<typename V, typename Er>
+    inline constexpr bool expected_trivially_move_assignable =
+        std::is_trivially_move_assignable_v<V> && std::is_trivially_move_constructible_v<V> && std::is_trivially_destructible_v<V> &&
+        std::is_trivially_move_assignable_v<Er> && std::is_trivially_move_constructible_v<Er> && std::is_trivially_destructible_v<Er>;
+
+    template<typename V, typename Er, bool = !(std::is_copy_assignable_v<V> && std::is_copy_constructible_v<V> && std::is_copy_assignable_v<Er> &&
+                                               std::is_copy_constructible_v<Er>) ||
+                                             expected_trivially_copy_assignable<V, Er>>
+    struct expected_copy_assign : expected_move<V, Er>
+    {
+        using expected_move<V, Er>::expected_move;
+    };
+
+    template<typename V, typename Er>
+    struct expected_copy_assign<V, Er, false> : expected_move<V, Er>
+    {
+        using base = expected_layout<V, Er>;
+        using expected_move<V, Er>::expected_move;
+        expected_copy_assign(expected_copy_assign const&) = default;
+        expected_copy_assign(expected_copy_assign&&)      = default;
+        expected_copy_assign& operator=(expected_copy_assign const& rhs)
+        {
+            expected_assign(*this, rhs);
             return *this;
         }
+        expected_copy_assign& operator=(expected_copy_assign&&) = default;
+    };
 
-        ~expected_storage()
+    template<typename V, typename Er, bool = !(std::is_move_assignable_v<V> && std::is_move_constructible_v<V> && std::is_move_assignable_v<Er> &&
+                                               std::is_move_constructible_v<Er>) ||
+                                             expected_trivially_move_assignable<V, Er>>
+    struct expected_storage : expected_copy_assign<V, Er>
+    {
+        using base = expected_layout<V, Er>;
+        using expected_copy_assign<V, Er>::expected_copy_assign;
+    };
+
+    template<typename V, typename Er>
+    struct expected_storage<V, Er, false> : expected_copy_assign<V, Er>
+    {
+        using base = expected_layout<V, Er>;
+        using expected_copy_assign<V, Er>::expected_copy_assign;
+        expected_storage(expected_storage const&)            = default;
+        expected_storage(expected_storage&&)                 = default;
+        expected_storage& operator=(expected_storage const&) = default;
+        expected_storage& operator=(expected_storage&& rhs) noexcept(std::is_nothrow_move_assignable_v<V> && std::is_nothrow_move_constructible_v<V> &&
+                                                                     std::is_nothrow_move_assignable_v<Er> && std::is_nothrow_move_constructible_v<Er>)
         {
-            if (has_val)
-            {
-                val.~val_t();
-            }
-            else
-            {
-                unex.~err_t();
-            }
+            expected_assign(*this, std::move(rhs));
+            return *this;
         }
     };
 
+    template<typename T>
+    struct is_expected : std::false_type
+    {};
+
+    template<typename T, typename E>
+    struct is_expected<ljh::expected<T, E>> : std::true_type
+    {};
+} // namespace _ljh
+
+namespace ljh
+{
     template<typename T, typename E>
     struct expected_traits
     {
@@ -293,9 +692,9 @@ namespace ljh
                       _ljh::copy_assignable<expected_traits<T, E>::copy_assignable>,
                       _ljh::move_assignable<expected_traits<T, E>::move_assignable>
     {
-        expected_storage<T, E> storage;
-        using val_t = typename expected_storage<T, E>::val_t;
-        using err_t = typename expected_storage<T, E>::err_t;
+        using val_t     = std::conditional_t<std::is_void_v<T>, _ljh::expected_empty, T>;
+        using storage_t = _ljh::expected_storage<val_t, E>;
+        storage_t storage;
 
     public:
         using value_type      = T;
@@ -305,7 +704,10 @@ namespace ljh
         template<typename U>
         using rebind = expected<U, error_type>;
 
-        constexpr expected()                           = default;
+        template<typename V = val_t, typename = std::enable_if_t<std::is_default_constructible_v<V>>>
+        constexpr expected()
+            : storage(in_place)
+        {}
         constexpr expected(expected const&)            = default;
         constexpr expected(expected&&)                 = default;
         constexpr expected& operator=(expected const&) = default;
@@ -324,18 +726,9 @@ namespace ljh
                 !std::is_convertible_v<expected<U, G> const&, unexpected<E>> && !std::is_convertible_v<expected<U, G> const&&, unexpected<E>>>,
             U>
         LJH_CPP20_EXPLICIT((!(std::is_void_v<T> && std::is_void_v<U>) && !std::is_convertible_v<U const&, T>) || !std::is_convertible_v<G const&, E>)
-        constexpr expected(expected<U, G> const& rhs)
-            : storage(rhs.storage.has_val)
-        {
-            if (rhs)
-            {
-                storage.val = rhs.storage.val;
-            }
-            else
-            {
-                storage.unex = rhs.storage.unex;
-            }
-        }
+        expected(expected<U, G> const& rhs)
+            : storage(_ljh::expected_from_t{}, rhs.storage)
+        {}
         template<typename U, typename G,
                  typename = std::enable_if_t<
                      std::is_constructible_v<T, U&&> && !std::is_constructible_v<T, expected<U, G>&> && !std::is_constructible_v<T, expected<U, G>&&> &&
@@ -348,18 +741,9 @@ namespace ljh
                      !std::is_convertible_v<expected<U, G> const&, unexpected<E>> && !std::is_convertible_v<expected<U, G> const&&, unexpected<E>>>,
                  U>
         LJH_CPP20_EXPLICIT((!(std::is_void_v<T> && std::is_void_v<U>) && !std::is_convertible_v<U&&, T>) || !std::is_convertible_v<G&&, E>)
-        constexpr expected(expected<U, G>&& rhs)
-            : storage(rhs.storage.has_val)
-        {
-            if (rhs)
-            {
-                storage.val = std::move(rhs.storage.val);
-            }
-            else
-            {
-                storage.unex = std::move(rhs.storage.unex);
-            }
-        }
+        expected(expected<U, G>&& rhs)
+            : storage(_ljh::expected_from_t{}, std::move(rhs.storage))
+        {}
 
         template<typename U = value_type,
                  typename   = std::enable_if_t<!std::is_void_v<T> && std::is_constructible_v<T, U&&> && !std::is_same_v<remove_cvref_t<U>, in_place_t> &&
@@ -367,37 +751,37 @@ namespace ljh
                                                !std::is_same_v<unexpected<error_type>, remove_cvref_t<U>>>>
         LJH_CPP20_EXPLICIT(!std::is_convertible_v<U&&, T>)
         constexpr expected(U&& rhs)
-            : storage(true, val_t{std::forward<U>(rhs)})
+            : storage(in_place, std::forward<U>(rhs))
         {}
 
         template<typename G = error_type, typename = std::enable_if_t<std::is_constructible_v<error_type, G const&>>>
         LJH_CPP20_EXPLICIT(!std::is_convertible_v<G const&, error_type>)
         constexpr expected(unexpected<G> const& rhs)
-            : storage(false, rhs.value(), unexpect)
+            : storage(unexpect, rhs.error())
         {}
         template<typename G = error_type, typename = std::enable_if_t<std::is_constructible_v<error_type, G&&>>>
         LJH_CPP20_EXPLICIT(!std::is_convertible_v<G&&, error_type>)
         constexpr expected(unexpected<G>&& rhs) noexcept(std::is_nothrow_constructible_v<error_type, G&&>)
-            : storage(false, std::move(rhs.error()), unexpect)
+            : storage(unexpect, std::move(rhs).error())
         {}
 
         template<class... Args, typename = std::enable_if_t<(std::is_void_v<value_type> && sizeof...(Args) == 0) ||
                                                             (!std::is_void_v<value_type> && std::is_constructible_v<value_type, Args...>)>>
         explicit constexpr expected(in_place_t, Args&&... args)
-            : storage(true, val_t{std::forward<Args>(args)...})
+            : storage(in_place, std::forward<Args>(args)...)
         {}
         template<typename U, class... Args,
                  typename = std::enable_if_t<!std::is_void_v<value_type> && std::is_constructible_v<value_type, std::initializer_list<U>&, Args...>>>
         explicit constexpr expected(in_place_t, std::initializer_list<U> il, Args&&... args)
-            : storage(true, val_t{il, std::forward<Args>(args)...})
+            : storage(in_place, il, std::forward<Args>(args)...)
         {}
         template<class... Args, typename = std::enable_if_t<std::is_constructible_v<E, Args...>>>
         explicit constexpr expected(unexpect_t, Args&&... args)
-            : storage(false, err_t{std::forward<Args>(args)...}, unexpect)
+            : storage(unexpect, std::forward<Args>(args)...)
         {}
         template<typename U, class... Args, typename = std::enable_if_t<std::is_constructible_v<E, std::initializer_list<U>&, Args...>>>
         explicit constexpr expected(unexpect_t, std::initializer_list<U> il, Args&&... args)
-            : storage(false, err_t{il, std::forward<Args>(args)...}, unexpect)
+            : storage(unexpect, il, std::forward<Args>(args)...)
         {}
 
         template<typename U = value_type,
@@ -406,12 +790,14 @@ namespace ljh
                                                std::is_assignable_v<val_t&, U> && std::is_nothrow_move_constructible_v<E>>>
         expected& operator=(U&& rhs)
         {
-            if (!storage.has_val)
+            if (has_value())
+            {
+                **this = std::forward<U>(rhs);
+            }
+            else
             {
-                storage.unex.~err_t();
-                storage.has_val = true;
+                _ljh::expected_reinit<true, val_t, false>(storage, storage_t::base::error_of(storage), std::forward<U>(rhs));
             }
-            new (&storage.val) val_t(std::forward<U>(rhs));
             return *this;
         }
         template<typename G = error_type, typename GF = G const&,
@@ -420,12 +806,14 @@ namespace ljh
                                               std::is_nothrow_move_constructible_v<E>)>>
         expected& operator=(unexpected<G> const& rhs)
         {
-            if (storage.has_val)
+            if (has_value())
+            {
+                _ljh::expected_reinit<false, E, true>(storage, storage_t::base::value_of(storage), rhs.error());
+            }
+            else
             {
-                storage.val.~val_t();
-                storage.has_val = false;
+                error() = rhs.error();
             }
-            new (&storage.unex) err_t(rhs.error());
             return *this;
         }
         template<typename G = error_type, typename GF = G,
@@ -434,211 +822,103 @@ namespace ljh
                                               std::is_nothrow_move_constructible_v<E>)>>
         expected& operator=(unexpected<G>&& rhs)
         {
-            if (storage.has_val)
+            if (has_value())
             {
-                storage.val.~val_t();
-                storage.has_val = false;
+                _ljh::expected_reinit<false, E, true>(storage, storage_t::base::value_of(storage), std::move(rhs).error());
+            }
+            else
+            {
+                error() = std::move(rhs).error();
             }
-            new (&storage.unex) err_t(std::move(rhs.error()));
             return *this;
         }
 
         template<typename V = value_type>
         std::enable_if_t<std::is_void_v<V>, V> emplace()
         {
-            if (!storage.has_val)
+            if (!has_value())
             {
-                storage.unex.~err_t();
-                storage.has_val = true;
+                storage.destroy();
+                storage.construct_value();
             }
         }
         template<class... Args, typename V = value_type>
         std::enable_if_t<!std::is_void_v<V>, V&> emplace(Args&&... args)
         {
-            if constexpr (std::is_nothrow_constructible_v<value_type, Args...>)
-            {
-                if (!storage.has_val)
-                {
-                    storage.unex.~err_t();
-                    storage.has_val = true;
-                }
-
-                new (&storage.val) val_t{std::forward<Args>(args)...};
-            }
-            else if constexpr (std::is_nothrow_move_constructible_v<value_type>)
-            {
-                auto temp = val_t{std::forward<Args>(args)...};
-                if (!storage.has_val)
-                {
-                    storage.unex.~err_t();
-                    storage.has_val = true;
-                }
-                storage.val = std::move(temp);
-            }
-            else
-            {
-                if (!storage.has_val)
-                {
-                    unexpected<error_type> tmp{std::move(storage.unex)};
-                    storage.unex.~err_t();
-                    try
-                    {
-
-                        new (&storage.val) val_t{std::forward<Args>(args)...};
-                    }
-                    catch (...)
-                    {
-                        storage.unex = std::move(tmp.value());
-                        throw;
-                    }
-                    storage.has_val = true;
-                }
-                else
-                {
-
-                    new (&storage.val) val_t{std::forward<Args>(args)...};
-                }
-            }
-            return storage.val;
+            _emplace(std::forward<Args>(args)...);
+            return **this;
         }
         template<typename U, class... Args, typename V = value_type>
         std::enable_if_t<!std::is_void_v<V>, V&> emplace(std::initializer_list<U> il, Args&&... args)
         {
-            if constexpr (std::is_nothrow_constructible_v<value_type, Args...>)
-            {
-                if (!storage.has_val)
-                {
-                    storage.unex.~err_t();
-                    storage.has_val = true;
-                }
-
-                new (&storage.val) val_t{il, std::forward<Args>(args)...};
-            }
-            else if constexpr (std::is_nothrow_move_constructible_v<value_type>)
-            {
-                auto temp = val_t{il, std::forward<Args>(args)...};
-                if (!storage.has_val)
-                {
-                    storage.unex.~err_t();
-                    storage.has_val = true;
-                }
-                storage.val = std::move(temp);
-            }
-            else
-            {
-                if (!storage.has_val)
-                {
-                    unexpected<error_type> tmp{std::move(storage.unex)};
-                    storage.unex.~err_t();
-                    try
-                    {
-                        new (&storage.val) val_t{il, std::forward<Args>(args)...};
-                    }
-                    catch (...)
-                    {
-                        storage.unex = std::move(tmp.value());
-                        throw;
-                    }
-                    storage.has_val = true;
-                }
-                else
-                {
-
-                    new (&storage.val) val_t{il, std::forward<Args>(args)...};
-                }
-            }
-            return storage.val;
+            _emplace(il, std::forward<Args>(args)...);
+            return **this;
         }
 
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V const*> operator->() const
+        constexpr std::enable_if_t<!std::is_void_v<V>, V const*> operator->() const noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::addressof(storage.val);
+            return std::addressof(**this);
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V*> operator->()
+        constexpr std::enable_if_t<!std::is_void_v<V>, V*> operator->() noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::addressof(storage.val);
+            return std::addressof(**this);
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V const&> operator*() const&
+        constexpr std::enable_if_t<!std::is_void_v<V>, V const&> operator*() const& noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return storage.val;
+            return storage_t::base::value_of(storage);
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V&> operator*() &
+        constexpr std::enable_if_t<!std::is_void_v<V>, V&> operator*() & noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return storage.val;
+            return storage_t::base::value_of(storage);
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V const&&> operator*() const&&
+        constexpr std::enable_if_t<!std::is_void_v<V>, V const&&> operator*() const&& noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::move(storage.val);
+            return storage_t::base::value_of(std::move(storage));
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V&&> operator*() &&
+        constexpr std::enable_if_t<!std::is_void_v<V>, V&&> operator*() && noexcept
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::move(storage.val);
+            return storage_t::base::value_of(std::move(storage));
         }
+
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V const&> value() const&
+        constexpr std::enable_if_t<std::is_void_v<V>, V> value() const
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return storage.val;
+            if (!has_value())
+                throw bad_expected_access<E>(error());
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V&> value() &
+        constexpr std::enable_if_t<!std::is_void_v<V>, V const&> value() const&
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return storage.val;
+            if (!has_value())
+                throw bad_expected_access<E>(error());
+            return **this;
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V const&&> value() const&&
+        constexpr std::enable_if_t<!std::is_void_v<V>, V&> value() &
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::move(storage.val);
+            if (!has_value())
+                throw bad_expected_access<E>(error());
+            return **this;
         }
         template<typename V = value_type>
-        constexpr std::enable_if_t<!std::is_void_v<T>, V&&> value() &&
+        constexpr std::enable_if_t<!std::is_void_v<V>, V const&&> value() const&&
         {
-            if (!storage.has_val)
-            {
-                throw bad_expected_access(error());
-            }
-            return std::move(storage.val);
+            if (!has_value())
+                throw bad_expected_access<E>(std::move(*this).error());
+            return std::move(**this);
+        }
+        template<typename V = value_type>
+        constexpr std::enable_if_t<!std::is_void_v<V>, V&&> value() &&
+        {
+            if (!has_value())
+                throw bad_expected_access<E>(std::move(*this).error());
+            return std::move(**this);
         }
 
         constexpr explicit operator bool() const noexcept
@@ -647,151 +927,251 @@ namespace ljh
         }
         constexpr bool has_value() const noexcept
         {
-            return storage.has_val;
+            return storage.has_value();
         }
 
-        constexpr error_type const& error() const&
+        constexpr error_type const& error() const& noexcept
         {
-            return storage.unex;
-        };
-        constexpr error_type& error() &
+            return storage_t::base::error_of(storage);
+        }
+        constexpr error_type& error() & noexcept
         {
-            return storage.unex;
-        };
-        constexpr error_type const&& error() const&&
+            return storage_t::base::error_of(storage);
+        }
+        constexpr error_type const&& error() const&& noexcept
         {
-            return std::move(storage.unex);
-        };
-        constexpr error_type&& error() &&
+            return storage_t::base::error_of(std::move(storage));
+        }
+        constexpr error_type&& error() && noexcept
         {
-            return std::move(storage.unex);
-        };
+            return storage_t::base::error_of(std::move(storage));
+        }
 
         template<typename U>
         constexpr value_type value_or(U&& rhs) const&
         {
-            return storage.has_val ? storage.val : static_cast<value_type>(std::forward<U>(rhs));
+            return has_value() ? **this : static_cast<value_type>(std::forward<U>(rhs));
         }
         template<typename U>
         constexpr value_type value_or(U&& rhs) &&
         {
-            return storage.has_val ? std::move(storage.val) : static_cast<value_type>(std::forward<U>(rhs));
-        }
-
-        template<typename T1, typename E1, typename T2, typename E2>
-        friend constexpr bool operator==(expected<T1, E1> const& lhs, expected<T2, E2> const& rhs);
-        template<typename T1, typename E1, typename T2, typename E2>
-        friend constexpr bool operator!=(expected<T1, E1> const& lhs, expected<T2, E2> const& rhs);
-
-        template<typename T1, typename E1, typename T2>
-        friend constexpr bool operator==(expected<T1, E1> const& lhs, const T2& rhs);
-        template<typename T1, typename E1, typename T2>
-        friend constexpr bool operator==(const T2& lhs, expected<T1, E1> const& rhs);
-        template<typename T1, typename E1, typename T2>
-        friend constexpr bool operator!=(expected<T1, E1> const& lhs, const T2& rhs);
-        template<typename T1, typename E1, typename T2>
-        friend constexpr bool operator!=(const T2& lhs, expected<T1, E1> const& rhs);
-
-        template<typename T1, typename E1, typename E2>
-        friend constexpr bool operator==(expected<T1, E1> const& lhs, unexpected<E2> const& rhs);
-        template<typename T1, typename E1, typename E2>
-        friend constexpr bool operator==(unexpected<E2> const& lhs, expected<T1, E1> const& rhs);
-        template<typename T1, typename E1, typename E2>
-        friend constexpr bool operator!=(expected<T1, E1> const& lhs, unexpected<E2> const& rhs);
-        template<typename T1, typename E1, typename E2>
-        friend constexpr bool operator!=(unexpected<E2> const& lhs, expected<T1, E1> const& rhs);
-
-        std::enable_if_t<std::is_void_v<T> || (std::is_move_constructible_v<T> || std::is_move_constructible_v<E>), void> swap(expected& rhs) noexcept(
-            std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<E> &&
-            std::is_nothrow_swappable_v<E>)
-        {
-            if (!rhs.storage.has_val)
+            return has_value() ? std::move(**this) : static_cast<value_type>(std::forward<U>(rhs));
+        }
+
+        // f takes the value and returns an expected with the same error_type
+        template<typename F>
+        constexpr auto and_then(F&& f) &
+        {
+            return _and_then(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto and_then(F&& f) const&
+        {
+            return _and_then(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto and_then(F&& f) &&
+        {
+            return _and_then(std::move(*this), std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto and_then(F&& f) const&&
+        {
+            return _and_then(std::move(*this), std::forward<F>(f));
+        }
+
+        // f takes the error and returns an expected with the same value_type
+        template<typename F>
+        constexpr auto or_else(F&& f) &
+        {
+            return _or_else(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto or_else(F&& f) const&
+        {
+            return _or_else(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto or_else(F&& f) &&
+        {
+            return _or_else(std::move(*this), std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto or_else(F&& f) const&&
+        {
+            return _or_else(std::move(*this), std::forward<F>(f));
+        }
+
+        // f takes the value and returns the new value
+        template<typename F>
+        constexpr auto transform(F&& f) &
+        {
+            return _transform(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform(F&& f) const&
+        {
+            return _transform(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform(F&& f) &&
+        {
+            return _transform(std::move(*this), std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform(F&& f) const&&
+        {
+            return _transform(std::move(*this), std::forward<F>(f));
+        }
+
+        // f takes the error and returns the new error
+        template<typename F>
+        constexpr auto transform_error(F&& f) &
+        {
+            return _transform_error(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform_error(F&& f) const&
+        {
+            return _transform_error(*this, std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform_error(F&& f) &&
+        {
+            return _transform_error(std::move(*this), std::forward<F>(f));
+        }
+        template<typename F>
+        constexpr auto transform_error(F&& f) const&&
+        {
+            return _transform_error(std::move(*this), std::forward<F>(f));
+        }
+
+        void swap(expected& rhs) noexcept(std::is_nothrow_move_constructible_v<val_t> && std::is_nothrow_swappable_v<val_t> &&
+                                          std::is_nothrow_move_constructible_v<E> && std::is_nothrow_swappable_v<E>)
+        {
+            using std::swap;
+            if (has_value() && rhs.has_value())
             {
-                if (storage.has_val)
-                {
-                    if constexpr (!std::is_void_v<T>)
-                    {
-                        using std::swap;
-                        swap(storage.val, rhs.storage.val);
-                    }
-                }
-                else
-                {
-                    rhs.storage.swap(*this);
-                }
+                swap(storage_t::base::value_of(storage), storage_t::base::value_of(rhs.storage));
+            }
+            else if (!has_value() && !rhs.has_value())
+            {
+                swap(error(), rhs.error());
             }
             else
             {
-                if (storage.has_val)
+                expected& with_value = has_value() ? *this : rhs;
+                expected& with_error = has_value() ? rhs : *this;
+
+                E temp = std::move(with_error).error();
+                with_error.storage.destroy();
+                if constexpr (std::is_nothrow_move_constructible_v<val_t>)
                 {
-                    if constexpr (std::is_void_v<T>)
-                    {
-                        storage.unex    = std::move(rhs.storage.unex);
-                        storage.has_val = false;
-                        rhs.storage.unex.~err_t();
-                        rhs.storage.has_val = true;
-                    }
-                    else if constexpr (std::is_nothrow_move_constructible_v<E>)
-                    {
-                        err_t tmp = std::move(rhs.storage.unex);
-                        rhs.storage.unex.~err_t();
-
-                        try
-                        {
-                            rhs.storage.val = std::move(storage.val);
-                            storage.val.~val_t();
-                            storage.unex        = std::move(tmp);
-                            storage.has_val     = false;
-                            rhs.storage.has_val = true;
-                        }
-                        catch (...)
-                        {
-                            rhs.storage.unex = std::move(tmp);
-                            tmp.~err_t();
-                            throw;
-                        }
-                    }
-                    else if constexpr (std::is_nothrow_move_constructible_v<T>)
+                    with_error.storage.construct_value(storage_t::base::value_of(std::move(with_value.storage)));
+                }
+                else
+                {
+                    try
                     {
-                        val_t tmp = std::move(rhs.storage.val);
-                        rhs.storage.val.~val_t();
-
-                        try
-                        {
-                            rhs.storage.unex = std::move(storage.unex);
-                            storage.unex.~err_t();
-                            storage.val         = std::move(tmp);
-                            storage.has_val     = false;
-                            rhs.storage.has_val = true;
-                        }
-                        catch (...)
-                        {
-                            rhs.storage.val = std::move(tmp);
-                            tmp.~val_t();
-                            throw;
-                        }
+                        with_error.storage.construct_value(storage_t::base::value_of(std::move(with_value.storage)));
                     }
-                    else if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_constructible_v<E>)
+                    catch (...)
                     {
-                        storage.val         = std::move(rhs.storage.val);
-                        rhs.storage.unex    = std::move(storage.unex);
-                        storage.has_val     = false;
-                        rhs.storage.has_val = true;
+                        with_error.storage.construct_error(std::move(temp));
+                        throw;
                     }
                 }
-                else
-                {
-                    using std::swap;
-                    swap(storage.unex, rhs.storage.unex);
-                }
+                with_value.storage.destroy();
+                with_value.storage.construct_error(std::move(temp));
+            }
+        }
+
+    private:
+        template<typename Self, typename F>
+        static constexpr auto _and_then(Self&& self, F&& f)
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                using R = remove_cvref_t<std::invoke_result_t<F>>;
+                static_assert(_ljh::is_expected<R>::value && std::is_same_v<typename R::error_type, E>, "and_then has to return an expected with the same error_type");
+                if (self.has_value())
+                    return R(std::invoke(std::forward<F>(f)));
+                return R(unexpect, std::forward<Self>(self).error());
+            }
+            else
+            {
+                using R = remove_cvref_t<std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>;
+                static_assert(_ljh::is_expected<R>::value && std::is_same_v<typename R::error_type, E>, "and_then has to return an expected with the same error_type");
+                if (self.has_value())
+                    return R(std::invoke(std::forward<F>(f), *std::forward<Self>(self)));
+                return R(unexpect, std::forward<Self>(self).error());
+            }
+        }
+
+        template<typename Self, typename F>
+        static constexpr auto _or_else(Self&& self, F&& f)
+        {
+            using R = remove_cvref_t<std::invoke_result_t<F, decltype(std::forward<Self>(self).error())>>;
+            static_assert(_ljh::is_expected<R>::value && std::is_same_v<typename R::value_type, T>, "or_else has to return an expected with the same value_type");
+            if (!self.has_value())
+                return R(std::invoke(std::forward<F>(f), std::forward<Self>(self).error()));
+            if constexpr (std::is_void_v<T>)
+                return R();
+            else
+                return R(in_place, *std::forward<Self>(self));
+        }
+
+        template<typename Self, typename F>
+        static constexpr auto _transform(Self&& self, F&& f)
+        {
+            if constexpr (std::is_void_v<T>)
+                return _transform_to<std::remove_cv_t<std::invoke_result_t<F>>>(std::forward<Self>(self), std::forward<F>(f));
+            else
+                return _transform_to<std::remove_cv_t<std::invoke_result_t<F, decltype(*std::forward<Self>(self))>>>(std::forward<Self>(self), std::forward<F>(f));
+        }
+
+        template<typename U, typename Self, typename F>
+        static constexpr expected<U, E> _transform_to(Self&& self, F&& f)
+        {
+            if (!self.has_value())
+                return expected<U, E>(unexpect, std::forward<Self>(self).error());
+
+            if constexpr (std::is_void_v<T> && std::is_void_v<U>)
+            {
+                std::invoke(std::forward<F>(f));
+                return expected<U, E>();
+            }
+            else if constexpr (std::is_void_v<T>)
+                return expected<U, E>(in_place, std::invoke(std::forward<F>(f)));
+            else if constexpr (std::is_void_v<U>)
+            {
+                std::invoke(std::forward<F>(f), *std::forward<Self>(self));
+                return expected<U, E>();
             }
+            else
+                return expected<U, E>(in_place, std::invoke(std::forward<F>(f), *std::forward<Self>(self)));
         }
 
-        template<typename T1, typename E1>
-        friend std::enable_if_t<!((std::is_void_v<T1> || std::is_move_constructible_v<T1>) && std::is_swappable_v<T1> && std::is_move_constructible_v<E1> &&
-                                  std::is_swappable_v<E1>),
-                                void>
-        swap(expected<T1, E1>& x, expected<T1, E1>& y) noexcept(noexcept(x.swap(y)));
+        template<typename Self, typename F>
+        static constexpr auto _transform_error(Self&& self, F&& f)
+        {
+            using G = std::remove_cv_t<std::invoke_result_t<F, decltype(std::forward<Self>(self).error())>>;
+            if (!self.has_value())
+                return expected<T, G>(unexpect, std::invoke(std::forward<F>(f), std::forward<Self>(self).error()));
+            if constexpr (std::is_void_v<T>)
+                return expected<T, G>();
+            else
+                return expected<T, G>(in_place, *std::forward<Self>(self));
+        }
+
+        template<class... Args>
+        void _emplace(Args&&... args)
+        {
+            if (has_value())
+                _ljh::expected_reinit<true, val_t, true>(storage, storage_t::base::value_of(storage), std::forward<Args>(args)...);
+            else
+                _ljh::expected_reinit<true, val_t, false>(storage, storage_t::base::error_of(storage), std::forward<Args>(args)...);
+        }
     };
 
     template<typename E>
@@ -802,39 +1182,43 @@ namespace ljh
 
         constexpr unexpected(unexpected const&) = default;
         constexpr unexpected(unexpected&&)      = default;
-        template<class... Args>
+        template<class... Args, typename = std::enable_if_t<std::is_constructible_v<E, Args...>>>
         constexpr explicit unexpected(in_place_t, Args&&... args)
-        {
-            val = value_type(std::forward<Args>(args)...);
-        }
-        template<typename U, class... Args>
+            : val(std::forward<Args>(args)...)
+        {}
+        template<typename U, class... Args, typename = std::enable_if_t<std::is_constructible_v<E, std::initializer_list<U>&, Args...>>>
         constexpr explicit unexpected(in_place_t, std::initializer_list<U> il, Args&&... args)
-        {
-            val = value_type(il, std::forward<Args>(args)...);
-        }
-        template<typename Err = value_type>
+            : val(il, std::forward<Args>(args)...)
+        {}
+        template<typename Err = value_type,
+                 typename     = std::enable_if_t<std::is_constructible_v<E, Err> && !std::is_same_v<remove_cvref_t<Err>, in_place_t> &&
+                                                 !std::is_same_v<remove_cvref_t<Err>, unexpected>>>
         constexpr explicit unexpected(Err&& rhs)
-        {
-            val = value_type(std::forward<Err>(rhs));
-        }
-        template<typename Err>
+            : val(std::forward<Err>(rhs))
+        {}
+        template<typename Err, typename = std::enable_if_t<std::is_constructible_v<E, Err const&>>>
         constexpr explicit unexpected(unexpected<Err> const& rhs)
-        {
-            val = rhs.val;
-        }
-        template<typename Err>
+            : val(rhs.error())
+        {}
+        template<typename Err, typename = std::enable_if_t<std::is_constructible_v<E, Err&&>>>
         constexpr explicit unexpected(unexpected<Err>&& rhs)
-        {
-            val = std::move(rhs.val);
-            rhs.val.~Err();
-        }
+            : val(std::move(rhs).error())
+        {}
 
         constexpr unexpected& operator=(unexpected const&) = default;
         constexpr unexpected& operator=(unexpected&&)      = default;
         template<typename Err = value_type>
-        constexpr unexpected& operator=(unexpected<Err> const&);
+        constexpr unexpected& operator=(unexpected<Err> const& rhs)
+        {
+            val = rhs.error();
+            return *this;
+        }
         template<typename Err = value_type>
-        constexpr unexpected& operator=(unexpected<Err>&&);
+        constexpr unexpected& operator=(unexpected<Err>&& rhs)
+        {
+            val = std::move(rhs).error();
+            return *this;
+        }
 
         constexpr value_type const& error() const& noexcept
         {
@@ -853,20 +1237,12 @@ namespace ljh
             return std::move(val);
         }
 
-        template<typename E1, typename E2>
-        friend constexpr bool operator==(unexpected<E1> const& lhs, unexpected<E2> const& rhs);
-        template<typename E1, typename E2>
-        friend constexpr bool operator!=(unexpected<E1> const& lhs, unexpected<E2> const& rhs);
-
-        std::enable_if_t<std::is_swappable_v<E>, void> swap(unexpected& rhs) noexcept(std::is_nothrow_swappable_v<E>)
+        void swap(unexpected& rhs) noexcept(std::is_nothrow_swappable_v<E>)
         {
             using std::swap;
             swap(val, rhs.val);
         }
 
-        template<typename E1>
-        friend std::enable_if_t<std::is_swappable_v<E1>, void> swap(unexpected<E1>& x, unexpected<E1>& y) noexcept(noexcept(x.swap(y)));
-
     private:
         value_type val;
     };
@@ -883,7 +1259,8 @@ namespace ljh
     {
     public:
         explicit bad_expected_access(E val)
-            : val(val) {};
+            : val(std::move(val))
+        {}
 
         virtual char const* what() const noexcept override
         {
@@ -914,14 +1291,14 @@ namespace ljh
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename T2, typename E2>
     constexpr bool operator==(expected<T1, E1> const& lhs, expected<T2, E2> const& rhs)
     {
-        if (lhs.storage.has_val != rhs.storage.has_val)
-        {
+        if (lhs.has_value() != rhs.has_value())
             return false;
-        }
-        if (lhs.storage.has_val)
-            return lhs.storage.val == rhs.storage.val;
+        if (!lhs.has_value())
+            return lhs.error() == rhs.error();
+        if constexpr (std::is_void_v<T1> || std::is_void_v<T2>)
+            return std::is_void_v<T1> && std::is_void_v<T2>;
         else
-            return lhs.storage.unex == rhs.storage.unex;
+            return *lhs == *rhs;
     }
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename T2, typename E2>
     constexpr bool operator!=(expected<T1, E1> const& lhs, expected<T2, E2> const& rhs)
@@ -932,11 +1309,11 @@ namespace ljh
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename T2>
     constexpr bool operator==(expected<T1, E1> const& lhs, const T2& rhs)
     {
-        if (!lhs.storage.has_val)
+        if (!lhs.has_value())
         {
             return false;
         }
-        return lhs.storage.val == rhs;
+        return *lhs == rhs;
     }
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename T2>
     constexpr bool operator==(const T2& lhs, expected<T1, E1> const& rhs)
@@ -957,11 +1334,11 @@ namespace ljh
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename E2>
     constexpr bool operator==(expected<T1, E1> const& lhs, unexpected<E2> const& rhs)
     {
-        if (lhs.storage.has_val)
+        if (lhs.has_value())
         {
             return false;
         }
-        return lhs.storage.val == rhs.val;
+        return lhs.error() == rhs.error();
     }
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1, typename E2>
     constexpr bool operator==(unexpected<E2> const& lhs, expected<T1, E1> const& rhs)
@@ -980,8 +1357,8 @@ namespace ljh
     }
 
     LJH_MODULE_MAIN_EXPORT template<typename T1, typename E1>
-    std::enable_if_t<!((std::is_void_v<T1> || std::is_move_constructible_v<T1>) && std::is_swappable_v<T1> && std::is_move_constructible_v<E1> &&
-                       std::is_swappable_v<E1>),
+    std::enable_if_t<(std::is_void_v<T1> || (std::is_move_constructible_v<T1> && std::is_swappable_v<T1>)) && std::is_move_constructible_v<E1> &&
+                         std::is_swappable_v<E1>,
                      void>
     swap(expected<T1, E1>& x, expected<T1, E1>& y) noexcept(noexcept(x.swap(y)))
     {
@@ -991,7 +1368,7 @@ namespace ljh
     LJH_MODULE_MAIN_EXPORT template<typename E1, typename E2>
     constexpr bool operator==(unexpected<E1> const& lhs, unexpected<E2> const& rhs)
     {
-        return lhs.val == rhs.val;
+        return lhs.error() == rhs.error();
     }
 
     LJH_MODULE_MAIN_EXPORT template<typename E1, typename E2>
@@ -1005,4 +1382,8 @@ namespace ljh
     {
         x.swap(y);
     }
-} // namespace ljh
\ No newline at end of file
+} // namespace ljh
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
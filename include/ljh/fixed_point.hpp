@@ -4,7 +4,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// fixed_point.hpp - v1.0
+// fixed_point.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++17
@@ -15,12 +15,16 @@
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add saturating math, sqrt, reciprocal, sin, cos and fixed_point_vec
 
 #pragma once
 #include "cpp_version.hpp"
 #include "int_types.hpp"
 #include "type_traits.hpp"
+#include <array>
 #include <climits>
+#include <cstddef>
+#include <limits>
 #if LJH_CPP_VERSION > LJH_CPP17_VERSION
 #if __has_include(<compare>)
 #include <compare>
@@ -89,6 +93,12 @@ namespace ljh
         static constexpr stor_t one    = stor_t(1) << fact_size;
 
     public:
+        using raw_type = stor_t;
+
+        static constexpr std::size_t storage_bits    = stor_size;
+        static constexpr std::size_t fractional_bits = fact_size;
+        static constexpr bool        is_signed       = _signed;
+
         constexpr fixed_point() noexcept = default;
 
         template<typename _value>
@@ -255,6 +265,351 @@ namespace ljh
     private:
         stor_t _data = 0;
     };
+
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> saturating_add(fixed_point<_storage_bits_size, _factional_bits_size, _signed> lhs,
+                                                                                          fixed_point<_storage_bits_size, _factional_bits_size, _signed> rhs) noexcept
+    {
+        using fixed = fixed_point<_storage_bits_size, _factional_bits_size, _signed>;
+        using raw_t = typename fixed::raw_type;
+        using raw_u = std::make_unsigned_t<raw_t>;
+
+        raw_u a = raw_u(lhs.as_raw());
+        raw_u b = raw_u(rhs.as_raw());
+        raw_u r = raw_u(a + b);
+
+        if constexpr (_signed)
+        {
+            // Overflow only happens when both sides have the same sign and the result does not.
+            if (raw_t((a ^ r) & (b ^ r)) < 0)
+                return fixed::from_raw(lhs.as_raw() < 0 ? std::numeric_limits<raw_t>::min() : std::numeric_limits<raw_t>::max());
+        }
+        else
+        {
+            if (r < a)
+                return fixed::from_raw(std::numeric_limits<raw_t>::max());
+        }
+        return fixed::from_raw(raw_t(r));
+    }
+
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> saturating_sub(fixed_point<_storage_bits_size, _factional_bits_size, _signed> lhs,
+                                                                                          fixed_point<_storage_bits_size, _factional_bits_size, _signed> rhs) noexcept
+    {
+        using fixed = fixed_point<_storage_bits_size, _factional_bits_size, _signed>;
+        using raw_t = typename fixed::raw_type;
+        using raw_u = std::make_unsigned_t<raw_t>;
+
+        raw_u a = raw_u(lhs.as_raw());
+        raw_u b = raw_u(rhs.as_raw());
+        raw_u r = raw_u(a - b);
+
+        if constexpr (_signed)
+        {
+            // Overflow only happens when the sides have different signs and the result does not match the left side.
+            if (raw_t((a ^ b) & (a ^ r)) < 0)
+                return fixed::from_raw(lhs.as_raw() < 0 ? std::numeric_limits<raw_t>::min() : std::numeric_limits<raw_t>::max());
+        }
+        else
+        {
+            if (b > a)
+                return fixed::from_raw(0);
+        }
+        return fixed::from_raw(raw_t(r));
+    }
+
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> reciprocal(fixed_point<_storage_bits_size, _factional_bits_size, _signed> value) noexcept
+    {
+        return fixed_point<_storage_bits_size, _factional_bits_size, _signed>(1) / value;
+    }
+
+    // Bit by bit square root of `raw << fractional_bits`, so no precision is lost to a pre-shift.
+    // Negative values return 0.
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> sqrt(fixed_point<_storage_bits_size, _factional_bits_size, _signed> value) noexcept
+    {
+        using fixed = fixed_point<_storage_bits_size, _factional_bits_size, _signed>;
+        using raw_t = typename fixed::raw_type;
+
+        constexpr std::size_t bits = _storage_bits_size + _factional_bits_size + ((_storage_bits_size + _factional_bits_size) & 1);
+        static_assert(bits / 2 + 3 <= 64, "fixed_point is to large to take the square root of");
+
+        if (value.as_raw() <= 0)
+            return fixed{};
+
+        u64 raw  = u64(std::make_unsigned_t<raw_t>(value.as_raw()));
+        u64 root = 0;
+        u64 rem  = 0;
+
+        for (std::size_t b = bits; b != 0; b -= 2)
+        {
+            u64 high = b - 1 >= _factional_bits_size && b - 1 - _factional_bits_size < _storage_bits_size ? (raw >> (b - 1 - _factional_bits_size)) & 1 : 0;
+            u64 low  = b - 2 >= _factional_bits_size && b - 2 - _factional_bits_size < _storage_bits_size ? (raw >> (b - 2 - _factional_bits_size)) & 1 : 0;
+
+            rem      = (rem << 2) | (high << 1) | low;
+            u64 test = (root << 2) | 1;
+            root <<= 1;
+            if (rem >= test)
+            {
+                rem -= test;
+                root |= 1;
+            }
+        }
+
+        return fixed::from_raw(raw_t(root));
+    }
+
+    constexpr double _f_taylor_sin(double x) noexcept
+    {
+        double term = x;
+        double sum  = x;
+        for (int n = 1; n < 16; ++n)
+        {
+            term *= -x * x / double((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    // Quarter wave of sin in Q2.30, 256 segments plus the end point.
+    // Generated at compile time so every platform gets the same bits.
+    inline constexpr std::array<s32, 257> _f_sin_table = [] {
+        std::array<s32, 257> table{};
+        for (std::size_t a = 0; a < table.size(); a++)
+        {
+            double v = _f_taylor_sin(double(a) * 3.14159265358979323846 / 512.0) * double(1 << 30);
+            table[a] = s32(v + 0.5);
+        }
+        return table;
+    }();
+
+    // `phase` is a full turn mapped to 2^32, result is in Q2.30.
+    constexpr s64 _f_sin_phase(u32 phase) noexcept
+    {
+        u32 quadrant = phase >> 30;
+        u32 pos      = phase & 0x3FFF'FFFF;
+        if (quadrant & 1)
+            pos = 0x4000'0000 - pos;
+
+        u32 index = pos >> 22;
+        s64 frac  = pos & 0x3F'FFFF;
+        s64 lo    = _f_sin_table[index];
+        s64 hi    = index + 1 < _f_sin_table.size() ? _f_sin_table[index + 1] : lo;
+        s64 v     = lo + (((hi - lo) * frac) >> 22);
+
+        return quadrant & 2 ? -v : v;
+    }
+
+    template<std::size_t _factional_bits_size, typename _raw>
+    constexpr u32 _f_radians_to_phase(_raw raw) noexcept
+    {
+        // Keep 2pi within 31 bits so the phase division stays in 64 bits.
+        constexpr std::size_t shift  = _factional_bits_size + 3 > 31 ? _factional_bits_size + 3 - 31 : 0;
+        constexpr s64         two_pi = s64(6.28318530717958647692 * double(u64(1) << (_factional_bits_size - shift)) + 0.5);
+
+        s64 m = s64(raw >> shift) % two_pi;
+        if (m < 0)
+            m += two_pi;
+        return u32((u64(m) << 32) / u64(two_pi));
+    }
+
+    template<typename _fixed>
+    constexpr _fixed _f_from_q30(s64 v) noexcept
+    {
+        using raw_t = typename _fixed::raw_type;
+        if constexpr (_fixed::fractional_bits >= 30)
+            return _fixed::from_raw(raw_t(v * (s64(1) << (_fixed::fractional_bits - 30))));
+        else
+            return _fixed::from_raw(raw_t(v >> (30 - _fixed::fractional_bits)));
+    }
+
+    // Table based sin, input in radians. Only integer math is used at runtime, so results are bit identical everywhere.
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> sin(fixed_point<_storage_bits_size, _factional_bits_size, _signed> value) noexcept
+    {
+        static_assert(_signed, "sin requires a signed fixed_point");
+        static_assert(_storage_bits_size - _factional_bits_size >= 2, "fixed_point can not hold the range of sin");
+        using fixed = fixed_point<_storage_bits_size, _factional_bits_size, _signed>;
+        return _f_from_q30<fixed>(_f_sin_phase(_f_radians_to_phase<_factional_bits_size>(value.as_raw())));
+    }
+
+    // Table based cos, input in radians. Only integer math is used at runtime, so results are bit identical everywhere.
+    LJH_MODULE_MATH_EXPORT template<std::size_t _storage_bits_size, std::size_t _factional_bits_size, bool _signed>
+    constexpr fixed_point<_storage_bits_size, _factional_bits_size, _signed> cos(fixed_point<_storage_bits_size, _factional_bits_size, _signed> value) noexcept
+    {
+        static_assert(_signed, "cos requires a signed fixed_point");
+        static_assert(_storage_bits_size - _factional_bits_size >= 2, "fixed_point can not hold the range of cos");
+        using fixed = fixed_point<_storage_bits_size, _factional_bits_size, _signed>;
+        return _f_from_q30<fixed>(_f_sin_phase(_f_radians_to_phase<_factional_bits_size>(value.as_raw()) + 0x4000'0000u));
+    }
+
+    // Fixed width batch of fixed_points. Every operation is a flat loop over the lanes with no
+    // cross-lane dependencies, so the compiler can turn it into packed multiply-high/add instructions
+    // while it stays usable in constant expressions.
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    struct fixed_point_vec
+    {
+        using value_type = _fixed;
+
+        static constexpr std::size_t size() noexcept
+        {
+            return _count;
+        }
+
+        static constexpr fixed_point_vec load(_fixed const* data) noexcept
+        {
+            fixed_point_vec out;
+            for (std::size_t a = 0; a < _count; a++)
+                out.lanes[a] = data[a];
+            return out;
+        }
+
+        static constexpr fixed_point_vec broadcast(_fixed value) noexcept
+        {
+            fixed_point_vec out;
+            for (std::size_t a = 0; a < _count; a++)
+                out.lanes[a] = value;
+            return out;
+        }
+
+        constexpr void store(_fixed* data) const noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                data[a] = lanes[a];
+        }
+
+        constexpr _fixed& operator[](std::size_t index) noexcept
+        {
+            return lanes[index];
+        }
+
+        constexpr _fixed const& operator[](std::size_t index) const noexcept
+        {
+            return lanes[index];
+        }
+
+        constexpr fixed_point_vec& operator+=(fixed_point_vec const& rhs) noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                lanes[a] += rhs.lanes[a];
+            return *this;
+        }
+
+        constexpr fixed_point_vec& operator-=(fixed_point_vec const& rhs) noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                lanes[a] -= rhs.lanes[a];
+            return *this;
+        }
+
+        constexpr fixed_point_vec& operator*=(fixed_point_vec const& rhs) noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                lanes[a] *= rhs.lanes[a];
+            return *this;
+        }
+
+        constexpr fixed_point_vec& operator/=(fixed_point_vec const& rhs) noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                lanes[a] /= rhs.lanes[a];
+            return *this;
+        }
+
+        friend constexpr fixed_point_vec operator+(fixed_point_vec const& lhs, fixed_point_vec const& rhs) noexcept
+        {
+            fixed_point_vec output = lhs;
+            return output += rhs;
+        }
+
+        friend constexpr fixed_point_vec operator-(fixed_point_vec const& lhs, fixed_point_vec const& rhs) noexcept
+        {
+            fixed_point_vec output = lhs;
+            return output -= rhs;
+        }
+
+        friend constexpr fixed_point_vec operator*(fixed_point_vec const& lhs, fixed_point_vec const& rhs) noexcept
+        {
+            fixed_point_vec output = lhs;
+            return output *= rhs;
+        }
+
+        friend constexpr fixed_point_vec operator/(fixed_point_vec const& lhs, fixed_point_vec const& rhs) noexcept
+        {
+            fixed_point_vec output = lhs;
+            return output /= rhs;
+        }
+
+        constexpr bool operator==(fixed_point_vec const& rhs) const noexcept
+        {
+            for (std::size_t a = 0; a < _count; a++)
+                if (!(lanes[a] == rhs.lanes[a]))
+                    return false;
+            return true;
+        }
+
+        constexpr bool operator!=(fixed_point_vec const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        std::array<_fixed, _count> lanes{};
+    };
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> saturating_add(fixed_point_vec<_fixed, _count> const& lhs, fixed_point_vec<_fixed, _count> const& rhs) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = saturating_add(lhs.lanes[a], rhs.lanes[a]);
+        return output;
+    }
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> saturating_sub(fixed_point_vec<_fixed, _count> const& lhs, fixed_point_vec<_fixed, _count> const& rhs) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = saturating_sub(lhs.lanes[a], rhs.lanes[a]);
+        return output;
+    }
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> reciprocal(fixed_point_vec<_fixed, _count> const& value) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = reciprocal(value.lanes[a]);
+        return output;
+    }
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> sqrt(fixed_point_vec<_fixed, _count> const& value) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = sqrt(value.lanes[a]);
+        return output;
+    }
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> sin(fixed_point_vec<_fixed, _count> const& value) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = sin(value.lanes[a]);
+        return output;
+    }
+
+    LJH_MODULE_MATH_EXPORT template<typename _fixed, std::size_t _count>
+    constexpr fixed_point_vec<_fixed, _count> cos(fixed_point_vec<_fixed, _count> const& value) noexcept
+    {
+        fixed_point_vec<_fixed, _count> output;
+        for (std::size_t a = 0; a < _count; a++)
+            output.lanes[a] = cos(value.lanes[a]);
+        return output;
+    }
 } // namespace ljh
 
 /*
@@ -0,0 +1,354 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// function.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++17
+//
+// ABOUT
+//     Owning and non-owning callable wrappers that don't need to copy, or allocate for, what they hold
+//
+//     inplace_function<Sig, Capacity, Alignment>
+//         Stores the callable in a Capacity byte buffer inside itself and never allocates, callables
+//         that don't fit are a compile error. Move only.
+//     move_only_function<Sig, InlineSize>
+//         Like inplace_function for callables up to InlineSize bytes, bigger ones go on the heap.
+//     function_ref<Sig>
+//         Points at a callable owned by someone else, two pointers big. Same lifetime rules as
+//         std::string_view.
+//
+//     Sig is a function type like `void(int)` or `void(int) noexcept`, for noexcept signatures the
+//     callable has to be noexcept too. Calls go through one indirect call with no empty check,
+//     calling an empty function throws std::bad_function_call (or terminates when Sig is noexcept).
+//
+// USAGE
+//     ljh::inplace_function<void(event const&), 48> on_event = [this, id](event const& e) { handle(id, e); };
+//     on_event(e);
+//
+//     void for_each_line(std::string_view text, ljh::function_ref<void(std::string_view)> callback);
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+
+#include "cpp_version.hpp"
+#include "function_traits.hpp"
+#include "type_traits.hpp"
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace _ljh
+{
+    template<typename T>
+    inline constexpr bool function_dependent_false = false;
+
+    template<typename Sig, std::size_t Capacity, std::size_t Alignment, bool allow_heap, typename = typename ljh::function_traits<Sig>::argument_types>
+    class basic_function;
+
+    template<typename Sig, std::size_t Capacity, std::size_t Alignment, bool allow_heap, typename... Args>
+    class basic_function<Sig, Capacity, Alignment, allow_heap, std::tuple<Args...>>
+    {
+        using traits = ljh::function_traits<Sig>;
+        static_assert(traits::is::function && !traits::is::variadic, "Sig has to be a non-variadic function type, like void(int)");
+        static_assert(!allow_heap || (Capacity >= sizeof(void*) && Alignment >= alignof(void*)), "the buffer also has to fit a pointer");
+
+    public:
+        using result_type = typename traits::return_type;
+
+    private:
+        using R                             = result_type;
+        static constexpr bool no_exceptions = traits::is::no_exceptions;
+
+        struct vtable
+        {
+            R (*invoke)(void*, Args&&...) noexcept(no_exceptions);
+            // Left null when a memcpy of the buffer or nothing at all is enough
+            void (*relocate)(void* to, void* from) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template<typename F>
+        static constexpr bool invocable = no_exceptions ? std::is_nothrow_invocable_r_v<R, F&, Args...> : std::is_invocable_r_v<R, F&, Args...>;
+
+        template<typename F>
+        static constexpr bool stored_inline = sizeof(F) <= Capacity && alignof(F) <= Alignment && std::is_nothrow_move_constructible_v<F>;
+
+        template<typename F>
+        static F* object(void* storage) noexcept
+        {
+            if constexpr (stored_inline<F>)
+                return std::launder(static_cast<F*>(storage));
+            else
+                return *static_cast<F**>(storage);
+        }
+
+        template<typename F>
+        static R invoke(void* storage, Args&&... args) noexcept(no_exceptions)
+        {
+            if constexpr (std::is_void_v<R>)
+                std::invoke(*object<F>(storage), std::forward<Args>(args)...);
+            else
+                return std::invoke(*object<F>(storage), std::forward<Args>(args)...);
+        }
+
+        [[noreturn]] static R invoke_empty(void*, Args&&...) noexcept(no_exceptions)
+        {
+            if constexpr (no_exceptions)
+                std::terminate();
+            else
+                throw std::bad_function_call();
+        }
+
+        template<typename F>
+        static void relocate(void* to, void* from) noexcept
+        {
+            F* source = object<F>(from);
+            ::new (to) F(std::move(*source));
+            source->~F();
+        }
+
+        template<typename F>
+        static void destroy(void* storage) noexcept
+        {
+            if constexpr (stored_inline<F>)
+                object<F>(storage)->~F();
+            else
+                delete object<F>(storage);
+        }
+
+        template<typename F>
+        static constexpr vtable table_for{
+            &invoke<F>,
+            stored_inline<F> && !std::is_trivially_copyable_v<F> ? &relocate<F> : nullptr,
+            !stored_inline<F> || !std::is_trivially_destructible_v<F> ? &destroy<F> : nullptr,
+        };
+
+        static constexpr vtable empty_table{&invoke_empty, nullptr, nullptr};
+
+        template<typename F>
+        static constexpr bool is_null(F const& f) noexcept
+        {
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F>)
+                return f == nullptr;
+            else
+                return false;
+        }
+
+        alignas(Alignment) unsigned char buffer[Capacity];
+        vtable const* table = &empty_table;
+
+        template<typename F, typename... CArgs>
+        void construct(CArgs&&... args)
+        {
+            if constexpr (stored_inline<F>)
+                ::new (static_cast<void*>(buffer)) F(std::forward<CArgs>(args)...);
+            else if constexpr (allow_heap)
+                ::new (static_cast<void*>(buffer)) F*(new F(std::forward<CArgs>(args)...));
+            else
+                static_assert(function_dependent_false<F>, "the callable has to fit in Capacity and Alignment and be nothrow move constructible");
+            table = &table_for<F>;
+        }
+
+        void take(basic_function& other) noexcept
+        {
+            if (other.table->relocate)
+                other.table->relocate(buffer, other.buffer);
+            else
+                std::memcpy(buffer, other.buffer, Capacity);
+            table       = other.table;
+            other.table = &empty_table;
+        }
+
+    public:
+        basic_function() noexcept = default;
+        basic_function(std::nullptr_t) noexcept
+        {}
+        template<typename F, typename D = std::decay_t<F>,
+                 typename = std::enable_if_t<!std::is_same_v<D, basic_function> && !ljh::is_instance_v<D, std::in_place_type_t> && invocable<D>>>
+        basic_function(F&& f)
+        {
+            if (!is_null(f))
+                construct<D>(std::forward<F>(f));
+        }
+        template<typename F, typename... CArgs, typename = std::enable_if_t<std::is_constructible_v<F, CArgs...> && invocable<F>>>
+        explicit basic_function(std::in_place_type_t<F>, CArgs&&... args)
+        {
+            construct<F>(std::forward<CArgs>(args)...);
+        }
+        basic_function(basic_function&& other) noexcept
+        {
+            take(other);
+        }
+        basic_function(basic_function const&) = delete;
+        ~basic_function()
+        {
+            if (table->destroy)
+                table->destroy(buffer);
+        }
+
+        basic_function& operator=(basic_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                *this = nullptr;
+                take(other);
+            }
+            return *this;
+        }
+        basic_function& operator=(basic_function const&) = delete;
+        basic_function& operator=(std::nullptr_t) noexcept
+        {
+            if (table->destroy)
+                table->destroy(buffer);
+            table = &empty_table;
+            return *this;
+        }
+        template<typename F, typename D = std::decay_t<F>, typename = std::enable_if_t<!std::is_same_v<D, basic_function> && invocable<D>>>
+        basic_function& operator=(F&& f)
+        {
+            return *this = basic_function(std::forward<F>(f));
+        }
+
+        void swap(basic_function& other) noexcept
+        {
+            basic_function temp{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+        friend void swap(basic_function& lhs, basic_function& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return table != &empty_table;
+        }
+
+        R operator()(Args... args) noexcept(no_exceptions)
+        {
+            return table->invoke(buffer, std::forward<Args>(args)...);
+        }
+
+        friend bool operator==(basic_function const& f, std::nullptr_t) noexcept
+        {
+            return !f;
+        }
+        friend bool operator==(std::nullptr_t, basic_function const& f) noexcept
+        {
+            return !f;
+        }
+        friend bool operator!=(basic_function const& f, std::nullptr_t) noexcept
+        {
+            return static_cast<bool>(f);
+        }
+        friend bool operator!=(std::nullptr_t, basic_function const& f) noexcept
+        {
+            return static_cast<bool>(f);
+        }
+    };
+
+    template<typename Sig, typename = typename ljh::function_traits<Sig>::argument_types>
+    class basic_function_ref;
+
+    template<typename Sig, typename... Args>
+    class basic_function_ref<Sig, std::tuple<Args...>>
+    {
+        using traits = ljh::function_traits<Sig>;
+        static_assert(traits::is::function && !traits::is::variadic, "Sig has to be a non-variadic function type, like void(int)");
+
+    public:
+        using result_type = typename traits::return_type;
+
+    private:
+        using R                             = result_type;
+        static constexpr bool no_exceptions = traits::is::no_exceptions;
+
+        // Function pointers can't be stored in a void*
+        union target
+        {
+            void const* object;
+            void (*function)();
+        };
+
+        template<typename F>
+        static constexpr bool invocable = no_exceptions ? std::is_nothrow_invocable_r_v<R, F, Args...> : std::is_invocable_r_v<R, F, Args...>;
+
+        template<typename F>
+        static R invoke_object(target bound, Args&&... args) noexcept(no_exceptions)
+        {
+            auto& f = *static_cast<F*>(const_cast<void*>(bound.object));
+            if constexpr (std::is_void_v<R>)
+                std::invoke(f, std::forward<Args>(args)...);
+            else
+                return std::invoke(f, std::forward<Args>(args)...);
+        }
+
+        template<typename F>
+        static R invoke_function(target bound, Args&&... args) noexcept(no_exceptions)
+        {
+            auto f = reinterpret_cast<F*>(bound.function);
+            if constexpr (std::is_void_v<R>)
+                std::invoke(f, std::forward<Args>(args)...);
+            else
+                return std::invoke(f, std::forward<Args>(args)...);
+        }
+
+        target bound;
+        R (*call)(target, Args&&...) noexcept(no_exceptions);
+
+    public:
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<ljh::remove_cvref_t<F>, basic_function_ref> && !std::is_member_pointer_v<ljh::remove_cvref_t<F>> &&
+                                                         invocable<std::remove_reference_t<F>&>>>
+        basic_function_ref(F&& f) noexcept
+        {
+            using D = std::remove_reference_t<F>;
+            if constexpr (std::is_function_v<D>)
+            {
+                bound.function = reinterpret_cast<void (*)()>(&f);
+                call           = &invoke_function<D>;
+            }
+            else if constexpr (std::is_pointer_v<D> && std::is_function_v<std::remove_pointer_t<D>>)
+            {
+                bound.function = reinterpret_cast<void (*)()>(f);
+                call           = &invoke_function<std::remove_pointer_t<D>>;
+            }
+            else
+            {
+                bound.object = std::addressof(f);
+                call         = &invoke_object<D>;
+            }
+        }
+
+        basic_function_ref(basic_function_ref const&)            = default;
+        basic_function_ref& operator=(basic_function_ref const&) = default;
+
+        R operator()(Args... args) const noexcept(no_exceptions)
+        {
+            return call(bound, std::forward<Args>(args)...);
+        }
+    };
+} // namespace _ljh
+
+namespace ljh
+{
+    LJH_MODULE_MAIN_EXPORT template<typename Sig, std::size_t Capacity = 32, std::size_t Alignment = alignof(std::max_align_t)>
+    using inplace_function = _ljh::basic_function<Sig, Capacity, Alignment, false>;
+
+    LJH_MODULE_MAIN_EXPORT template<typename Sig, std::size_t InlineSize = 3 * sizeof(void*)>
+    using move_only_function = _ljh::basic_function<Sig, InlineSize, alignof(std::max_align_t), true>;
+
+    LJH_MODULE_MAIN_EXPORT template<typename Sig>
+    using function_ref = _ljh::basic_function_ref<Sig>;
+} // namespace ljh
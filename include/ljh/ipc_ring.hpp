@@ -0,0 +1,508 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// ipc_ring.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++20
+// Requires memory_mapped_file.hpp
+// Requires source/ipc_ring.cpp
+//
+// ABOUT
+//     Ring buffers of variable length records for passing data between processes
+//
+//     The ring lives entirely inside a block of shared memory, usually a memory mapped file,
+//     so a record is copied once into the ring and read in place by the consumer. The
+//     producer and consumer indices are on their own cache lines and each side keeps a
+//     local copy of the other's index, so neither touches the other's cache line until
+//     the ring looks full or empty. Blocking reads and writes sleep on a futex in the
+//     shared memory, and only enter the kernel to wake the other side when it is asleep.
+//
+//     `spsc_ring` has one producer and one consumer. `mpsc_ring` lets any number of
+//     producers, in any number of processes and threads, reserve space with a compare
+//     exchange, and one mpsc_ring object can be shared by several producer threads. Its
+//     consumer zeroes what it has read, so a record that is reserved but not yet written
+//     is never mistaken for a finished one. If the callback passed to emplace throws, the
+//     reserved space is marked to be skipped before the exception leaves. A producer process
+//     that dies between reserving and writing a record can't do that, and the consumer
+//     waits on that record forever.
+//
+//     Every process has to use the same kind of ring and capacity for the same memory.
+//
+// USAGE
+//     // In every process
+//     ljh::ipc::mapped_ring<ljh::ipc::spsc_ring> ring{"/dev/shm/my_app_ingest", 1 << 20};
+//
+//     // Producer
+//     ring->write(std::as_bytes(std::span{message}));
+//
+//     // Consumer
+//     ring->read([](std::span<std::byte const> record) { ... });
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+#include "memory_mapped_file.hpp"
+#include "thread_slot.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace _ljh
+{
+    // Waits while `word` is `expected`, can return early. A negative timeout waits forever.
+    void ipc_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::int64_t timeout_nanoseconds) noexcept;
+    void ipc_wake_all(std::atomic<std::uint32_t>& word) noexcept;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::uint32_t>::is_always_lock_free, "shared memory needs address free atomics");
+
+    struct ipc_ring_control
+    {
+        enum : std::uint32_t
+        {
+            uninitialized,
+            initializing,
+            ready,
+        };
+        static constexpr std::uint32_t magic_value = 0x474E5252; // "RRNG"
+
+        alignas(cache_line_size) std::atomic<std::uint32_t> state;
+        std::uint32_t magic;
+        std::uint32_t multi_producer;
+        std::uint64_t capacity;
+
+        // Written by producers
+        alignas(cache_line_size) std::atomic<std::uint64_t> head;
+        std::atomic<std::uint32_t> data_signal;
+        std::atomic<std::uint32_t> producers_waiting;
+
+        // Written by the consumer
+        alignas(cache_line_size) std::atomic<std::uint64_t> tail;
+        std::atomic<std::uint32_t> space_signal;
+        std::atomic<std::uint32_t> consumer_waiting;
+    };
+
+    // Every record starts with one of these, the record itself follows, padded to 8 bytes.
+    // `size` is the record size plus one once it is written, 0 while it isn't. A record that was
+    // reserved but never written is a `skip` with its framed length in `reserved`.
+    struct ipc_record_header
+    {
+        static constexpr std::uint32_t padding = 0x8000'0000;
+        static constexpr std::uint32_t skip    = 0x8000'0001;
+
+        std::atomic<std::uint32_t> size;
+        std::uint32_t              reserved;
+    };
+    static_assert(sizeof(ipc_record_header) == 8);
+
+    template<bool multi_producer>
+    class ipc_ring
+    {
+        using clock = std::chrono::steady_clock;
+
+        static constexpr std::uint64_t record_alignment = sizeof(ipc_record_header);
+
+        ipc_ring_control* _control  = nullptr;
+        std::byte*        _data     = nullptr;
+        std::uint64_t     _mask     = 0;
+        // Last seen value of the other side's index, refreshed only when it looks full or empty. Any
+        // number of threads can produce through one mpsc_ring, so there the cached tail is atomic and
+        // passes on the consumer's release of the space it covers.
+        std::conditional_t<multi_producer, std::atomic<std::uint64_t>, std::uint64_t> _cached_tail = 0;
+        std::uint64_t                                                                  _cached_head = 0;
+
+    public:
+        static constexpr std::size_t header_size = sizeof(ipc_ring_control);
+
+        // Bytes of shared memory needed for a ring of `capacity` bytes, rounded up to a power of 2.
+        [[nodiscard]] static constexpr std::size_t required_size(std::size_t capacity) noexcept
+        {
+            return header_size + std::bit_ceil(capacity < 64 ? std::size_t(64) : capacity);
+        }
+
+        ipc_ring() = default;
+
+        // Uses `memory` for the ring, setting it up if this is the first process to use it. `memory`
+        // must be zero filled before any process uses it, and aligned to a cache line.
+        ipc_ring(void* memory, std::size_t size)
+        {
+            if (memory == nullptr || size < required_size(64) || reinterpret_cast<std::uintptr_t>(memory) % cache_line_size != 0)
+                throw std::invalid_argument("ipc ring memory is too small or misaligned");
+
+            _control                = static_cast<ipc_ring_control*>(memory);
+            _data                   = static_cast<std::byte*>(memory) + header_size;
+            std::uint64_t capacity  = std::bit_floor(size - header_size);
+            std::uint32_t expected  = ipc_ring_control::uninitialized;
+            if (_control->state.compare_exchange_strong(expected, ipc_ring_control::initializing, std::memory_order_acquire))
+            {
+                _control->magic          = ipc_ring_control::magic_value;
+                _control->multi_producer = multi_producer;
+                _control->capacity       = capacity;
+                _control->state.store(ipc_ring_control::ready, std::memory_order_release);
+                ipc_wake_all(_control->state);
+            }
+            else
+            {
+                while ((expected = _control->state.load(std::memory_order_acquire)) != ipc_ring_control::ready)
+                    ipc_wait(_control->state, expected, -1);
+            }
+
+            if (_control->magic != ipc_ring_control::magic_value || _control->multi_producer != multi_producer || _control->capacity != capacity)
+                throw std::invalid_argument("ipc ring memory is used by a different kind of ring");
+
+            _mask = capacity - 1;
+            _set_cached_tail(_control->tail.load(std::memory_order_acquire));
+            _cached_head = _control->head.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return _mask + 1;
+        }
+
+        [[nodiscard]] std::size_t max_record_size() const noexcept
+        {
+            // The size word keeps its top bit for padding
+            return std::min<std::size_t>(capacity() - sizeof(ipc_record_header), ipc_record_header::padding - 2);
+        }
+
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return _control != nullptr;
+        }
+
+        // Producer
+
+        // Calls `fill` with `size` bytes inside the ring to write the record into.
+        template<typename Fill>
+        [[nodiscard]] bool try_emplace(std::size_t size, Fill&& fill)
+        {
+            return _write(size, fill, clock::time_point::min());
+        }
+
+        template<typename Fill>
+        void emplace(std::size_t size, Fill&& fill)
+        {
+            _write(size, fill, clock::time_point::max());
+        }
+
+        template<typename Fill, typename Rep, typename Period>
+        [[nodiscard]] bool emplace_for(std::size_t size, Fill&& fill, std::chrono::duration<Rep, Period> const& timeout)
+        {
+            return _write(size, fill, clock::now() + std::chrono::ceil<clock::duration>(timeout));
+        }
+
+        [[nodiscard]] bool try_write(std::span<std::byte const> record)
+        {
+            return try_emplace(record.size(), _copy_from{record});
+        }
+
+        void write(std::span<std::byte const> record)
+        {
+            emplace(record.size(), _copy_from{record});
+        }
+
+        template<typename Rep, typename Period>
+        [[nodiscard]] bool write_for(std::span<std::byte const> record, std::chrono::duration<Rep, Period> const& timeout)
+        {
+            return emplace_for(record.size(), _copy_from{record}, timeout);
+        }
+
+        // Consumer
+
+        // Calls `consume` with the oldest record, which is only valid until `consume` returns.
+        template<typename Consume>
+        [[nodiscard]] bool try_read(Consume&& consume)
+        {
+            return _read(consume, clock::time_point::min());
+        }
+
+        template<typename Consume>
+        void read(Consume&& consume)
+        {
+            _read(consume, clock::time_point::max());
+        }
+
+        template<typename Consume, typename Rep, typename Period>
+        [[nodiscard]] bool read_for(Consume&& consume, std::chrono::duration<Rep, Period> const& timeout)
+        {
+            return _read(consume, clock::now() + std::chrono::ceil<clock::duration>(timeout));
+        }
+
+        // Bytes written but not yet read, including framing.
+        [[nodiscard]] std::size_t size_approx() const noexcept
+        {
+            return std::size_t(_control->head.load(std::memory_order_relaxed) - _control->tail.load(std::memory_order_relaxed));
+        }
+
+    private:
+        struct _copy_from
+        {
+            std::span<std::byte const> record;
+
+            void operator()(std::span<std::byte> destination) const noexcept
+            {
+                if (!record.empty())
+                    std::memcpy(destination.data(), record.data(), record.size());
+            }
+        };
+
+        static constexpr std::uint64_t _framed(std::size_t size) noexcept
+        {
+            return (sizeof(ipc_record_header) + size + record_alignment - 1) & ~(record_alignment - 1);
+        }
+
+        ipc_record_header& _header_at(std::uint64_t position) const noexcept
+        {
+            return *reinterpret_cast<ipc_record_header*>(_data + (position & _mask));
+        }
+
+        // Sleeps until `signal` moves on from `seen`, `deadline` passes or `ready` is true.
+        // Returns false once the deadline has passed.
+        template<typename Ready>
+        static bool _wait(std::atomic<std::uint32_t>& signal, std::atomic<std::uint32_t>& waiting, clock::time_point deadline, Ready&& ready)
+        {
+            if (deadline == clock::time_point::min())
+                return false;
+
+            std::uint32_t seen = signal.load(std::memory_order_relaxed);
+            waiting.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool timed_out = false;
+            if (!ready())
+            {
+                std::int64_t timeout = -1;
+                if (deadline != clock::time_point::max())
+                {
+                    auto now  = clock::now();
+                    timeout   = now < deadline ? std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count() : 0;
+                    timed_out = timeout == 0;
+                }
+                if (!timed_out)
+                    ipc_wait(signal, seen, timeout);
+            }
+            waiting.fetch_sub(1, std::memory_order_relaxed);
+            return !timed_out;
+        }
+
+        static void _signal(std::atomic<std::uint32_t>& signal, std::atomic<std::uint32_t>& waiting) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting.load(std::memory_order_relaxed) != 0)
+            {
+                signal.fetch_add(1, std::memory_order_relaxed);
+                ipc_wake_all(signal);
+            }
+        }
+
+        std::uint64_t _get_cached_tail() const noexcept
+        {
+            if constexpr (multi_producer)
+                return _cached_tail.load(std::memory_order_acquire);
+            else
+                return _cached_tail;
+        }
+
+        void _set_cached_tail(std::uint64_t tail) noexcept
+        {
+            if constexpr (multi_producer)
+                _cached_tail.store(tail, std::memory_order_release);
+            else
+                _cached_tail = tail;
+        }
+
+        // The tail only moves forward, so a stale cached tail just makes the ring look fuller
+        bool _has_space(std::uint64_t head, std::uint64_t needed)
+        {
+            if (head + needed - _get_cached_tail() <= capacity())
+                return true;
+            std::uint64_t tail = _control->tail.load(std::memory_order_acquire);
+            _set_cached_tail(tail);
+            return head + needed - tail <= capacity();
+        }
+
+        // Space for `size` bytes at `head`, or the padding to skip to the start of the ring first.
+        std::uint64_t _needed(std::uint64_t head, std::size_t size, bool& pad) const noexcept
+        {
+            std::uint64_t framed    = _framed(size);
+            std::uint64_t until_end = capacity() - (head & _mask);
+            pad                     = framed > until_end;
+            return pad ? until_end : framed;
+        }
+
+        template<typename Fill>
+        bool _write(std::size_t size, Fill& fill, clock::time_point deadline)
+        {
+            if (size > max_record_size())
+                throw std::length_error("record is larger than the ipc ring");
+
+            for (;;)
+            {
+                bool          pad;
+                std::uint64_t head   = _control->head.load(std::memory_order_relaxed);
+                std::uint64_t needed = _needed(head, size, pad);
+
+                if (!_has_space(head, needed))
+                {
+                    auto ready = [&] { return _has_space(head, needed) || _control->head.load(std::memory_order_relaxed) != head; };
+                    if (!_wait(_control->space_signal, _control->producers_waiting, deadline, ready))
+                        return false;
+                    continue;
+                }
+
+                if constexpr (multi_producer)
+                {
+                    if (!_control->head.compare_exchange_weak(head, head + needed, std::memory_order_relaxed))
+                        continue;
+                }
+
+                ipc_record_header& header = _header_at(head);
+                if (pad)
+                {
+                    header.size.store(ipc_record_header::padding, std::memory_order_release);
+                }
+                else if constexpr (multi_producer)
+                {
+                    try
+                    {
+                        fill(std::span<std::byte>{reinterpret_cast<std::byte*>(&header + 1), size});
+                    }
+                    catch (...)
+                    {
+                        // The space is already reserved, the consumer has to be told to skip it
+                        header.reserved = std::uint32_t(needed);
+                        header.size.store(ipc_record_header::skip, std::memory_order_release);
+                        _signal(_control->data_signal, _control->consumer_waiting);
+                        throw;
+                    }
+                    header.size.store(std::uint32_t(size + 1), std::memory_order_release);
+                }
+                else
+                {
+                    fill(std::span<std::byte>{reinterpret_cast<std::byte*>(&header + 1), size});
+                    header.size.store(std::uint32_t(size + 1), std::memory_order_release);
+                }
+
+                if constexpr (!multi_producer)
+                    _control->head.store(head + needed, std::memory_order_release);
+
+                _signal(_control->data_signal, _control->consumer_waiting);
+                if (!pad)
+                    return true;
+            }
+        }
+
+        // The size word of the record at `tail`, 0 when there isn't one yet.
+        std::uint32_t _record_at(std::uint64_t tail)
+        {
+            if constexpr (multi_producer)
+            {
+                return _header_at(tail).size.load(std::memory_order_acquire);
+            }
+            else
+            {
+                if (tail == _cached_head && tail == (_cached_head = _control->head.load(std::memory_order_acquire)))
+                    return 0;
+                return _header_at(tail).size.load(std::memory_order_relaxed);
+            }
+        }
+
+        void _release(std::uint64_t tail, std::uint64_t framed)
+        {
+            // Producers that reserve this space next rely on it being zero
+            if constexpr (multi_producer)
+                std::memset(_data + (tail & _mask), 0, framed);
+            _control->tail.store(tail + framed, std::memory_order_release);
+            _signal(_control->space_signal, _control->producers_waiting);
+        }
+
+        template<typename Consume>
+        bool _read(Consume& consume, clock::time_point deadline)
+        {
+            for (;;)
+            {
+                std::uint64_t tail = _control->tail.load(std::memory_order_relaxed);
+                std::uint32_t size = _record_at(tail);
+
+                if (size == 0)
+                {
+                    if (!_wait(_control->data_signal, _control->consumer_waiting, deadline, [&] { return _record_at(tail) != 0; }))
+                        return false;
+                    continue;
+                }
+
+                if (size == ipc_record_header::padding)
+                {
+                    _release(tail, capacity() - (tail & _mask));
+                    continue;
+                }
+                if (size == ipc_record_header::skip)
+                {
+                    _release(tail, _header_at(tail).reserved);
+                    continue;
+                }
+
+                std::size_t record = size - 1;
+                consume(std::span<std::byte const>{reinterpret_cast<std::byte const*>(&_header_at(tail) + 1), record});
+                _release(tail, _framed(record));
+                return true;
+            }
+        }
+    };
+} // namespace _ljh
+
+namespace ljh::ipc
+{
+    LJH_MODULE_OS_EXPORT using spsc_ring = _ljh::ipc_ring<false>;
+    LJH_MODULE_OS_EXPORT using mpsc_ring = _ljh::ipc_ring<true>;
+
+    // A ring in a memory mapped file, created and sized by whichever process opens it first.
+    LJH_MODULE_OS_EXPORT template<typename Ring>
+    class mapped_ring
+    {
+        memory_mapped::file _file;
+        memory_mapped::view _view;
+        Ring                _ring;
+
+        static memory_mapped::file _open(std::filesystem::path path, std::size_t size)
+        {
+            // Opening for append creates the file without truncating one another process made
+            std::ofstream{path, std::ios::binary | std::ios::app};
+            if (std::filesystem::file_size(path) < size)
+                std::filesystem::resize_file(path, size);
+            return memory_mapped::file{std::move(path), memory_mapped::permissions::rw};
+        }
+
+    public:
+        mapped_ring(std::filesystem::path path, std::size_t capacity)
+            : _file(_open(std::move(path), Ring::required_size(capacity)))
+            , _view(_file, memory_mapped::permissions::rw, 0, Ring::required_size(capacity))
+            , _ring(_view.template as<std::byte>(), Ring::required_size(capacity))
+        {}
+
+        Ring& get() noexcept
+        {
+            return _ring;
+        }
+
+        Ring* operator->() noexcept
+        {
+            return &_ring;
+        }
+    };
+} // namespace ljh::ipc
@@ -0,0 +1,391 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// metrics.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++20
+//
+// ABOUT
+//     Counters, gauges and histograms that can be updated from any number of threads without locks
+//
+//     counter
+//         Split into one cache line per thread slot, so threads adding to the same counter don't
+//         fight over a cache line. Adding is a relaxed fetch_add on the thread's own line, reading
+//         adds up every line. Threads get slots round-robin, there are as many slots as the next
+//         power of two of std::thread::hardware_concurrency() (up to 256).
+//     gauge
+//         A single value that goes up and down, on a cache line of its own.
+//     basic_histogram<Precision>
+//         Log-linear buckets like HdrHistogram, values under 2^Precision each get a bucket and every
+//         power of two above that is split into 2^Precision buckets, so a recorded value is off by at
+//         most 1/2^Precision. histogram uses 5 bits (about 3%) in 1920 buckets. snapshot() copies the
+//         buckets out into a histogram_snapshot, which can be merged with += and queried for
+//         percentiles. For very hot histograms keep one per thread and merge their snapshots.
+//
+//     With <format> all of them, and snapshots, can be passed to std::format, including through
+//     ljh::fmt::join. Counters and gauges take the integer format spec, histograms print their
+//     count, min, p50, p90, p99 and max.
+//
+// USAGE
+//     ljh::metrics::counter   requests;
+//     ljh::metrics::histogram latency_us;
+//
+//     requests++;
+//     latency_us.record(elapsed.count());
+//
+//     auto totals = latency_us.snapshot();
+//     std::format("{} requests, p99 {}us", requests, totals.percentile(99));
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+#include "thread_slot.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+namespace ljh::metrics
+{
+    LJH_MODULE_MAIN_EXPORT class counter
+    {
+        struct alignas(_ljh::cache_line_size) cell
+        {
+            std::atomic<std::uint64_t> value{0};
+        };
+
+        std::size_t             _mask  = _ljh::thread_slot_count() - 1;
+        std::unique_ptr<cell[]> _cells = std::make_unique<cell[]>(_mask + 1);
+
+    public:
+        counter() = default;
+
+        void add(std::uint64_t amount = 1) noexcept
+        {
+            _cells[_ljh::thread_slot() & _mask].value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        counter& operator+=(std::uint64_t amount) noexcept
+        {
+            add(amount);
+            return *this;
+        }
+
+        counter& operator++() noexcept
+        {
+            add(1);
+            return *this;
+        }
+
+        void operator++(int) noexcept
+        {
+            add(1);
+        }
+
+        // Adds that happen while this is reading might or might not be counted.
+        std::uint64_t value() const noexcept
+        {
+            std::uint64_t total = 0;
+            for (std::size_t a = 0; a <= _mask; a++)
+                total += _cells[a].value.load(std::memory_order_relaxed);
+            return total;
+        }
+
+        // Returns the count and starts again from 0, without losing adds that happen meanwhile.
+        std::uint64_t take() noexcept
+        {
+            std::uint64_t total = 0;
+            for (std::size_t a = 0; a <= _mask; a++)
+                total += _cells[a].value.exchange(0, std::memory_order_relaxed);
+            return total;
+        }
+    };
+
+    LJH_MODULE_MAIN_EXPORT class alignas(_ljh::cache_line_size) gauge
+    {
+        std::atomic<std::int64_t> _value{0};
+
+    public:
+        gauge() = default;
+        explicit gauge(std::int64_t initial) noexcept
+            : _value(initial)
+        {}
+
+        void set(std::int64_t value) noexcept
+        {
+            _value.store(value, std::memory_order_relaxed);
+        }
+
+        void add(std::int64_t amount) noexcept
+        {
+            _value.fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        void sub(std::int64_t amount) noexcept
+        {
+            _value.fetch_sub(amount, std::memory_order_relaxed);
+        }
+
+        gauge& operator=(std::int64_t value) noexcept
+        {
+            set(value);
+            return *this;
+        }
+
+        gauge& operator+=(std::int64_t amount) noexcept
+        {
+            add(amount);
+            return *this;
+        }
+
+        gauge& operator-=(std::int64_t amount) noexcept
+        {
+            sub(amount);
+            return *this;
+        }
+
+        std::int64_t value() const noexcept
+        {
+            return _value.load(std::memory_order_relaxed);
+        }
+    };
+
+    LJH_MODULE_MAIN_EXPORT template<unsigned Precision>
+    struct histogram_buckets
+    {
+        static_assert(Precision >= 1 && Precision <= 16, "Precision is the number of bits kept of each value");
+
+        static constexpr std::uint64_t sub_buckets = std::uint64_t(1) << Precision;
+        static constexpr std::size_t   count       = (65 - Precision) * sub_buckets;
+
+        static constexpr std::size_t index_of(std::uint64_t value) noexcept
+        {
+            if (value < sub_buckets)
+                return std::size_t(value);
+            auto shift = unsigned(std::bit_width(value)) - 1 - Precision;
+            return std::size_t(shift * sub_buckets + (value >> shift));
+        }
+
+        // Smallest value that goes in the bucket
+        static constexpr std::uint64_t lowest(std::size_t index) noexcept
+        {
+            if (index < sub_buckets)
+                return index;
+            auto shift = unsigned(index / sub_buckets) - 1;
+            return (index - shift * sub_buckets) << shift;
+        }
+
+        // Largest value that goes in the bucket
+        static constexpr std::uint64_t highest(std::size_t index) noexcept
+        {
+            return index + 1 == count ? std::numeric_limits<std::uint64_t>::max() : lowest(index + 1) - 1;
+        }
+    };
+
+    LJH_MODULE_MAIN_EXPORT template<unsigned Precision>
+    class histogram_snapshot
+    {
+        template<unsigned>
+        friend class basic_histogram;
+
+    public:
+        using buckets = histogram_buckets<Precision>;
+
+        std::uint64_t count() const noexcept
+        {
+            return _count;
+        }
+
+        // Only exact while the sum fits in 64 bits
+        std::uint64_t sum() const noexcept
+        {
+            return _sum;
+        }
+
+        std::uint64_t min() const noexcept
+        {
+            return _count ? _min : 0;
+        }
+
+        std::uint64_t max() const noexcept
+        {
+            return _max;
+        }
+
+        double mean() const noexcept
+        {
+            return _count ? double(_sum) / double(_count) : 0.0;
+        }
+
+        std::uint64_t bucket(std::size_t index) const noexcept
+        {
+            return _counts[index];
+        }
+
+        // The highest value in the bucket holding the given percentile (0 to 100) of values, clamped
+        // to what was actually recorded so percentile(0) and percentile(100) give min and max.
+        std::uint64_t percentile(double percent) const noexcept
+        {
+            if (_count == 0 || percent <= 0)
+                return min();
+            auto rank = std::uint64_t(std::clamp(percent, 0.0, 100.0) / 100.0 * double(_count) + 0.5);
+            rank      = std::clamp<std::uint64_t>(rank, 1, _count);
+
+            std::uint64_t seen = 0;
+            for (std::size_t a = 0; a < buckets::count; a++)
+            {
+                seen += _counts[a];
+                if (seen >= rank)
+                    return std::clamp(buckets::highest(a), min(), _max);
+            }
+            return _max;
+        }
+
+        histogram_snapshot& operator+=(histogram_snapshot const& other) noexcept
+        {
+            for (std::size_t a = 0; a < buckets::count; a++)
+                _counts[a] += other._counts[a];
+            if (other._count)
+            {
+                _min = _count ? std::min(_min, other._min) : other._min;
+                _max = std::max(_max, other._max);
+            }
+            _count += other._count;
+            _sum += other._sum;
+            return *this;
+        }
+
+        friend histogram_snapshot operator+(histogram_snapshot lhs, histogram_snapshot const& rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+    private:
+        std::array<std::uint64_t, buckets::count> _counts{};
+        std::uint64_t                             _count = 0;
+        std::uint64_t                             _sum   = 0;
+        std::uint64_t                             _min   = 0;
+        std::uint64_t                             _max   = 0;
+    };
+
+    LJH_MODULE_MAIN_EXPORT template<unsigned Precision>
+    class basic_histogram
+    {
+    public:
+        using buckets       = histogram_buckets<Precision>;
+        using snapshot_type = histogram_snapshot<Precision>;
+
+        void record(std::uint64_t value, std::uint64_t times = 1) noexcept
+        {
+            _counts[buckets::index_of(value)].fetch_add(times, std::memory_order_relaxed);
+            _sum.fetch_add(value * times, std::memory_order_relaxed);
+
+            // Only loops while the value is a new minimum or maximum
+            auto low = _min.load(std::memory_order_relaxed);
+            while (value < low && !_min.compare_exchange_weak(low, value, std::memory_order_relaxed))
+            {}
+            auto high = _max.load(std::memory_order_relaxed);
+            while (value > high && !_max.compare_exchange_weak(high, value, std::memory_order_relaxed))
+            {}
+        }
+
+        // Values recorded while the snapshot is taken might be missing from the count or the sum.
+        snapshot_type snapshot() const noexcept
+        {
+            snapshot_type out;
+            for (std::size_t a = 0; a < buckets::count; a++)
+            {
+                out._counts[a] = _counts[a].load(std::memory_order_relaxed);
+                out._count += out._counts[a];
+            }
+            out._sum = _sum.load(std::memory_order_relaxed);
+            out._min = _min.load(std::memory_order_relaxed);
+            out._max = _max.load(std::memory_order_relaxed);
+            return out;
+        }
+
+        // Not atomic with respect to concurrent records, those can land on either side of it.
+        void reset() noexcept
+        {
+            for (auto& value : _counts)
+                value.store(0, std::memory_order_relaxed);
+            _sum.store(0, std::memory_order_relaxed);
+            _min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, buckets::count>       _counts{};
+        alignas(_ljh::cache_line_size) std::atomic<std::uint64_t> _sum{0};
+        alignas(_ljh::cache_line_size) std::atomic<std::uint64_t> _min{std::numeric_limits<std::uint64_t>::max()};
+        std::atomic<std::uint64_t>                                   _max{0};
+    };
+
+    LJH_MODULE_MAIN_EXPORT using histogram = basic_histogram<5>;
+} // namespace ljh::metrics
+
+#if __has_include(<format>)
+namespace std
+{
+    template<typename C>
+    struct formatter<ljh::metrics::counter, C> : std::formatter<std::uint64_t, C>
+    {
+        template<typename FC>
+        FC::iterator format(ljh::metrics::counter const& value, FC& ctx) const
+        {
+            return std::formatter<std::uint64_t, C>::format(value.value(), ctx);
+        }
+    };
+
+    template<typename C>
+    struct formatter<ljh::metrics::gauge, C> : std::formatter<std::int64_t, C>
+    {
+        template<typename FC>
+        FC::iterator format(ljh::metrics::gauge const& value, FC& ctx) const
+        {
+            return std::formatter<std::int64_t, C>::format(value.value(), ctx);
+        }
+    };
+
+    template<unsigned Precision>
+    struct formatter<ljh::metrics::histogram_snapshot<Precision>, char>
+    {
+        template<typename PC>
+        constexpr PC::iterator parse(PC& ctx)
+        {
+            return ctx.begin();
+        }
+
+        template<typename FC>
+        FC::iterator format(ljh::metrics::histogram_snapshot<Precision> const& value, FC& ctx) const
+        {
+            return std::format_to(ctx.out(), "count={} min={} p50={} p90={} p99={} max={}", value.count(), value.min(), value.percentile(50),
+                                  value.percentile(90), value.percentile(99), value.max());
+        }
+    };
+
+    template<unsigned Precision>
+    struct formatter<ljh::metrics::basic_histogram<Precision>, char> : formatter<ljh::metrics::histogram_snapshot<Precision>, char>
+    {
+        template<typename FC>
+        FC::iterator format(ljh::metrics::basic_histogram<Precision> const& value, FC& ctx) const
+        {
+            return formatter<ljh::metrics::histogram_snapshot<Precision>, char>::format(value.snapshot(), ctx);
+        }
+    };
+} // namespace std
+#endif
@@ -4,24 +4,43 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// get_index.hpp - v1.0
+// named_mutex.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++20
 // Requires cpp_version.hpp
 // Requires compile_time_string.hpp
+// Requires source/windows/named_mutex.cpp or source/unix/named_mutex.cpp
 //
 // ABOUT
+//     A mutex shared by every process that uses the same name
+//
+//     On Linux the mutex lives in shared memory, locking and unlocking it without
+//     contention is a single compare exchange and never enters the kernel. If a process
+//     dies while holding it the next process to lock it takes ownership, like a Windows
+//     mutex that was abandoned. If a process dies while setting up the shared memory, the
+//     next process to open it waits a second and then sets up a spare mutex next to it
+//     instead. After 3 takeovers that never finish, opening the mutex fails.
 //
 // USAGE
+//     using namespace ljh::compile_time_string_literals;
+//     ljh::named_mutex<"my_app_workers"_cts> mutex;
+//     std::scoped_lock lock{mutex};
+//
+//     if (mutex.try_lock_for(std::chrono::milliseconds{50}))
+//         mutex.unlock();
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add try_lock_for and try_lock_until, futex based mutex on Linux
 
 #pragma once
 
 #include "cpp_version.hpp"
 #include "compile_time_string.hpp"
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
 
 namespace ljh
 {
@@ -31,6 +50,7 @@ namespace ljh
         void  release_mutex(void* object);
         void  lock_mutex(void* object);
         bool  try_lock_mutex(void* object);
+        bool  try_lock_mutex_for(void* object, std::int64_t nanoseconds);
         void  unlock_mutex(void* object);
     } // namespace __
 
@@ -65,7 +85,20 @@ namespace ljh
             return __::try_lock_mutex(__object);
         }
 
+        template<typename Rep, typename Period>
+        [[nodiscard]] bool try_lock_for(std::chrono::duration<Rep, Period> const& timeout) const noexcept
+        {
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+            return __::try_lock_mutex_for(__object, nanoseconds > 0 ? nanoseconds : 0);
+        }
+
+        template<typename Clock, typename Duration>
+        [[nodiscard]] bool try_lock_until(std::chrono::time_point<Clock, Duration> const& deadline) const noexcept
+        {
+            return try_lock_for(deadline - Clock::now());
+        }
+
     private:
         void* __object;
     };
-} // namespace ljh
\ No newline at end of file
+} // namespace ljh
\ No newline at end of file
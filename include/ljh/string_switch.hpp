@@ -0,0 +1,271 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// string_switch.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++20
+//
+// ABOUT
+//     Maps a runtime string to the index of a matching compile time string
+//
+//     A minimal perfect hash table (hash and displace) is built at compile time, so a
+//     lookup is one hash of the input, two table reads and a single verification compare.
+//     Sets of 8 keys or less skip the hash and compare the input's length and first
+//     8 bytes against every key in one pass instead.
+//
+// USAGE
+//     using namespace ljh::compile_time_string_literals;
+//     using verbs = ljh::string_switch<"GET"_cts, "POST"_cts, "PUT"_cts, "DELETE"_cts>;
+//
+//     switch (verbs::find(method))
+//     {
+//     case verbs::index_of<"GET"_cts>: ...
+//     case verbs::index_of<"POST"_cts>: ...
+//     case verbs::npos: // not one of the keys
+//     }
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+#include "compile_time_string.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if __cpp_nontype_template_args >= 201911L
+namespace _ljh
+{
+    template<typename... T>
+    struct string_switch_char
+    {
+        using type = char;
+    };
+
+    template<typename T, typename... R>
+    struct string_switch_char<T, R...>
+    {
+        using type = typename std::remove_cv_t<T>::char_type;
+    };
+
+    inline constexpr std::size_t string_switch_linear_max = 8;
+
+    constexpr std::uint64_t string_switch_mix(std::uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCD;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Packs the first 8 bytes worth of code units, zero padded.
+    template<typename C>
+    constexpr std::uint64_t string_switch_word(C const* s, std::size_t count) noexcept
+    {
+        constexpr std::size_t per_word = sizeof(C) < 8 ? 8 / sizeof(C) : 1;
+        std::uint64_t         word     = 0;
+        for (std::size_t a = 0; a < per_word && a < count; a++)
+            word |= std::uint64_t(static_cast<std::make_unsigned_t<C>>(s[a])) << (a * 8 * sizeof(C) % 64);
+        return word;
+    }
+
+    template<typename C>
+    constexpr std::uint64_t string_switch_hash(std::basic_string_view<C> text) noexcept
+    {
+        constexpr std::size_t per_word = sizeof(C) < 8 ? 8 / sizeof(C) : 1;
+        std::uint64_t         h        = 0x9E3779B97F4A7C15 * (text.size() + 1);
+        for (std::size_t a = 0; a < text.size(); a += per_word)
+        {
+            h ^= string_switch_word(text.data() + a, text.size() - a);
+            h *= 0xBF58476D1CE4E5B9;
+            h ^= h >> 29;
+        }
+        return string_switch_mix(h);
+    }
+
+    template<typename C, std::size_t N>
+    constexpr bool string_switch_unique(std::basic_string_view<C> const (&keys)[N]) noexcept
+    {
+        for (std::size_t a = 0; a < N; a++)
+            for (std::size_t b = a + 1; b < N; b++)
+                if (keys[a] == keys[b])
+                    return false;
+        return true;
+    }
+
+    template<std::size_t N>
+    struct string_switch_table
+    {
+        std::array<std::uint32_t, N> seeds{};
+        std::array<std::uint32_t, N> slots{};
+    };
+
+    // Hash and displace: keys are grouped into N buckets by their hash, then the largest
+    // buckets first each search for a seed that moves all of their keys into free slots.
+    template<std::size_t N>
+    constexpr string_switch_table<N> string_switch_build(std::array<std::uint64_t, N> const& hashes)
+    {
+        string_switch_table<N>     table{};
+        std::array<std::size_t, N> bucket_size{};
+        std::array<std::size_t, N> order{};
+        std::array<bool, N>        used{};
+        std::array<std::size_t, N> taken{};
+
+        for (std::size_t a = 0; a < N; a++)
+        {
+            bucket_size[hashes[a] % N]++;
+            order[a] = a;
+        }
+        for (std::size_t a = 0; a < N; a++)
+            for (std::size_t b = a + 1; b < N; b++)
+                if (bucket_size[order[b]] > bucket_size[order[a]])
+                    std::swap(order[a], order[b]);
+
+        for (std::size_t bucket : order)
+        {
+            if (bucket_size[bucket] == 0)
+                break;
+
+            for (std::uint32_t seed = 1;; seed++)
+            {
+                // The keys are unique, so only two of them hashing to the same value ends up here
+                if (seed == 0x10000)
+                    throw std::logic_error("no perfect hash found for these keys");
+
+                std::size_t count = 0;
+                bool        fits  = true;
+                for (std::size_t key = 0; key < N && fits; key++)
+                {
+                    if (hashes[key] % N != bucket)
+                        continue;
+                    std::size_t slot = string_switch_mix(hashes[key] + seed) % N;
+                    fits             = !used[slot];
+                    for (std::size_t a = 0; a < count && fits; a++)
+                        fits = taken[a] != slot;
+                    taken[count++] = slot;
+                }
+                if (!fits)
+                    continue;
+
+                count = 0;
+                for (std::size_t key = 0; key < N; key++)
+                {
+                    if (hashes[key] % N != bucket)
+                        continue;
+                    used[taken[count]]        = true;
+                    table.slots[taken[count]] = static_cast<std::uint32_t>(key);
+                    count++;
+                }
+                table.seeds[bucket] = seed;
+                break;
+            }
+        }
+        return table;
+    }
+} // namespace _ljh
+
+namespace ljh
+{
+    LJH_MODULE_STRING_EXPORT template<compile_time_string... Keys>
+    struct string_switch
+    {
+        using char_type = typename _ljh::string_switch_char<decltype(Keys)...>::type;
+        static_assert((std::is_same_v<typename std::remove_cv_t<decltype(Keys)>::char_type, char_type> && ...), "all keys must use the same character type");
+
+        static constexpr std::size_t size = sizeof...(Keys);
+        static constexpr std::size_t npos = size;
+
+    private:
+        static constexpr std::basic_string_view<char_type> keys[size == 0 ? 1 : size] = {std::basic_string_view<char_type>(Keys)...};
+        static_assert(_ljh::string_switch_unique(keys), "string_switch keys must be unique");
+
+        static constexpr auto table = []
+        {
+            if constexpr (size > _ljh::string_switch_linear_max)
+            {
+                std::array<std::uint64_t, size> hashes{};
+                for (std::size_t a = 0; a < size; a++)
+                    hashes[a] = _ljh::string_switch_hash(keys[a]);
+                return _ljh::string_switch_build(hashes);
+            }
+            else
+            {
+                struct
+                {
+                    std::array<std::uint64_t, size> prefix{};
+                    std::array<std::size_t, size>   length{};
+                } table;
+                for (std::size_t a = 0; a < size; a++)
+                {
+                    table.prefix[a] = _ljh::string_switch_word(keys[a].data(), keys[a].size());
+                    table.length[a] = keys[a].size();
+                }
+                return table;
+            }
+        }();
+
+        static constexpr std::size_t _index_of(std::basic_string_view<char_type> key)
+        {
+            for (std::size_t a = 0; a < size; a++)
+                if (keys[a] == key)
+                    return a;
+            throw std::logic_error("key is not part of this string_switch");
+        }
+
+    public:
+        template<compile_time_string Key>
+        static constexpr std::size_t index_of = _index_of(Key);
+
+        // Index of the key equal to `text`, or npos.
+        [[nodiscard]] static constexpr std::size_t find(std::basic_string_view<char_type> text) noexcept
+        {
+            if constexpr (size == 0)
+            {
+                return npos;
+            }
+            else if constexpr (size > _ljh::string_switch_linear_max)
+            {
+                std::uint64_t h    = _ljh::string_switch_hash(text);
+                std::size_t   slot = _ljh::string_switch_mix(h + table.seeds[h % size]) % size;
+                std::size_t   key  = table.slots[slot];
+                return keys[key] == text ? key : npos;
+            }
+            else
+            {
+                std::uint64_t prefix = _ljh::string_switch_word(text.data(), text.size());
+                std::uint32_t match  = 0;
+                for (std::size_t a = 0; a < size; a++)
+                    match |= std::uint32_t((table.prefix[a] == prefix) & (table.length[a] == text.size())) << a;
+                for (; match != 0; match &= match - 1)
+                {
+                    std::size_t key = std::countr_zero(match);
+                    if (keys[key] == text)
+                        return key;
+                }
+                return npos;
+            }
+        }
+
+        [[nodiscard]] constexpr std::size_t operator()(std::basic_string_view<char_type> text) const noexcept
+        {
+            return find(text);
+        }
+
+        [[nodiscard]] static constexpr std::basic_string_view<char_type> key(std::size_t index) noexcept
+        {
+            return index < size ? keys[index] : std::basic_string_view<char_type>{};
+        }
+    };
+} // namespace ljh
+#endif
@@ -4,7 +4,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// string_utils.hpp - v1.0
+// string_utils.hpp - v1.3
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++11
@@ -16,6 +16,9 @@
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add basic_split_view and split_lazy
+//     1.2 Locale free trimming with Unicode whitespace, add trim_view
+//     1.3 convert_string uses utf.hpp instead of the C locale
 
 #pragma once
 
@@ -27,31 +30,108 @@
 #include <locale>
 #include <codecvt>
 #include <cwchar>
+#include <cstring>
+#include <cstdint>
 
 #if __cpp_lib_string_view >= 201606L
 #include <string_view>
+#include <iterator>
 #include "get_index.hpp"
+#include "utf.hpp"
 #endif
 
+#if __has_include(<ranges>) && __cpp_lib_ranges
+#include "ranges/range_adaptor_closure.hpp"
+#endif
+
+namespace ljh
+{
+    // Classifies Unicode White_Space without going through the C locale.
+    // Single byte characters are treated as ascii, matching std::isspace in the "C" locale.
+    LJH_MODULE_STRING_EXPORT template<typename C>
+    LJH_CPP14_CONSTEXPR bool is_space(C ch) noexcept
+    {
+        auto c = static_cast<std::uint32_t>(static_cast<typename std::make_unsigned<C>::type>(ch));
+        if (c == 0x20 || (c >= 0x09 && c <= 0x0D))
+            return true;
+        if (sizeof(C) == 1 || c < 0x85)
+            return false;
+
+        constexpr std::uint32_t ranges[][2] = {
+            {0x0085, 0x0085}, {0x00A0, 0x00A0}, {0x1680, 0x1680}, {0x2000, 0x200A}, {0x2028, 0x2029},
+            {0x202F, 0x202F}, {0x205F, 0x205F}, {0x3000, 0x3000},
+        };
+        for (auto const& range : ranges)
+            if (c >= range[0] && c <= range[1])
+                return true;
+        return false;
+    }
+} // namespace ljh
+
+namespace _ljh
+{
+    template<typename C>
+    std::size_t leading_space(C const* text, std::size_t size) noexcept
+    {
+        std::size_t a = 0;
+        LJH_IF_CONSTEXPR(sizeof(C) == 1)
+        {
+            // Padding is almost always plain spaces, so skip those a word at a time.
+            while (size - a >= 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, text + a, 8);
+                if (word != 0x2020202020202020)
+                    break;
+                a += 8;
+            }
+        }
+        while (a < size && ljh::is_space(text[a]))
+            a++;
+        return a;
+    }
+
+    template<typename C>
+    std::size_t trailing_space(C const* text, std::size_t size) noexcept
+    {
+        std::size_t a = size;
+        LJH_IF_CONSTEXPR(sizeof(C) == 1)
+        {
+            while (a >= 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, text + a - 8, 8);
+                if (word != 0x2020202020202020)
+                    break;
+                a -= 8;
+            }
+        }
+        while (a > 0 && ljh::is_space(text[a - 1]))
+            a--;
+        return size - a;
+    }
+} // namespace _ljh
+
 namespace ljh
 {
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
     void ltrim(std::basic_string<C, T, A>& s)
     {
-        s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](C ch) { return !std::isspace(ch); }));
+        s.erase(0, _ljh::leading_space(s.data(), s.size()));
     }
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
     void rtrim(std::basic_string<C, T, A>& s)
     {
-        s.erase(std::find_if(s.rbegin(), s.rend(), [](C ch) { return !std::isspace(ch); }).base(), s.end());
+        s.erase(s.size() - _ljh::trailing_space(s.data(), s.size()));
     }
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
     void trim(std::basic_string<C, T, A>& s)
     {
-        ltrim(s);
+        // Trim the end first so the front erase moves less memory.
         rtrim(s);
+        ltrim(s);
     }
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
@@ -118,30 +198,15 @@ namespace ljh
     }
 
 #if __cpp_lib_string_view >= 201606L
+    // UTF-8 to UTF-16 on Windows, UTF-32 elsewhere. See utf.hpp.
     LJH_MODULE_STRING_EXPORT inline std::wstring convert_string(std::string_view str)
     {
-        auto op = [state = std::mbstate_t(), from = str.data()](wchar_t* buf, size_t len) mutable noexcept { return std::mbsrtowcs(buf, &from, len, &state); };
-        std::wstring output;
-#if __cpp_lib_string_resize_and_overwrite >= 202110L
-        output.resize_and_overwrite(op(nullptr, 0), op);
-#else
-        output.resize(op(nullptr, 0));
-        output.resize(op(output.data(), output.size()));
-#endif
-        return output;
+        return transcode<wchar_t>(str);
     }
 
     LJH_MODULE_STRING_EXPORT inline std::string convert_string(std::wstring_view wstr)
     {
-        auto op = [state = std::mbstate_t(), from = wstr.data()](char* buf, size_t len) mutable noexcept { return std::wcsrtombs(buf, &from, len, &state); };
-        std::string output;
-#if __cpp_lib_string_resize_and_overwrite >= 202110L
-        output.resize_and_overwrite(op(nullptr, 0), op);
-#else
-        output.resize(op(nullptr, 0));
-        output.resize(op(output.data(), output.size()));
-#endif
-        return output;
+        return transcode<char>(wstr);
     }
 #else
     LJH_MODULE_STRING_EXPORT inline std::wstring convert_string(const std::string& str)
@@ -159,13 +224,13 @@ namespace ljh
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
     void ltrim(std::basic_string_view<C, T>& s)
     {
-        s.remove_prefix(get_index_if(s.begin(), s.end(), [](C ch) { return !std::isspace(ch); }));
+        s.remove_prefix(_ljh::leading_space(s.data(), s.size()));
     }
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
     void rtrim(std::basic_string_view<C, T>& s)
     {
-        s.remove_suffix(get_index_if(s.rbegin(), s.rend(), [](C ch) { return !std::isspace(ch); }));
+        s.remove_suffix(_ljh::trailing_space(s.data(), s.size()));
     }
 
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
@@ -196,6 +261,32 @@ namespace ljh
         return s;
     }
 
+    // Returns the trimmed part of `s` as a view, leaving the string untouched.
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    std::basic_string_view<C, T> ltrim_view(std::basic_string<C, T, A> const& s) noexcept
+    {
+        return ltrim_copy(std::basic_string_view<C, T>(s));
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    std::basic_string_view<C, T> rtrim_view(std::basic_string<C, T, A> const& s) noexcept
+    {
+        return rtrim_copy(std::basic_string_view<C, T>(s));
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    std::basic_string_view<C, T> trim_view(std::basic_string<C, T, A> const& s) noexcept
+    {
+        return trim_copy(std::basic_string_view<C, T>(s));
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    void ltrim_view(std::basic_string<C, T, A>&& s) = delete;
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    void rtrim_view(std::basic_string<C, T, A>&& s) = delete;
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>, typename A = std::allocator<C>>
+    void trim_view(std::basic_string<C, T, A>&& s) = delete;
+
     LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
     std::vector<std::basic_string_view<C, T>> split(std::basic_string_view<C, T> const& s, C seperator, std::size_t max_elements = 0)
     {
@@ -237,5 +328,174 @@ namespace ljh
         output.push_back(s.substr(prev_pos));
         return output;
     }
+
+    // Lazily splits a string on a separator, yielding views into the original string.
+    // Nothing is allocated, so the string must outlive the view and its iterators.
+    // Single character separators are found with `traits::find` (memchr for char).
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
+    class basic_split_view
+    {
+    public:
+        using string_view_type = std::basic_string_view<C, T>;
+        using size_type        = typename string_view_type::size_type;
+
+        class iterator
+        {
+        public:
+#if __cpp_lib_ranges
+            using iterator_concept = std::forward_iterator_tag;
+#endif
+            using iterator_category = std::input_iterator_tag;
+            using value_type        = string_view_type;
+            using difference_type   = std::ptrdiff_t;
+            using reference         = string_view_type;
+            using pointer           = void;
+
+            constexpr iterator() noexcept = default;
+
+            constexpr reference operator*() const noexcept
+            {
+                return _text.substr(_start, _stop - _start);
+            }
+
+            constexpr iterator& operator++() noexcept
+            {
+                if (_last)
+                {
+                    _done = true;
+                    return *this;
+                }
+                _start = _stop + (_single ? 1 : _separator.size());
+                if (_left > 0)
+                    _left--;
+                find_stop();
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                iterator temp = *this;
+                ++*this;
+                return temp;
+            }
+
+            friend constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept
+            {
+                return lhs._done == rhs._done && (lhs._done || lhs._start == rhs._start);
+            }
+
+            friend constexpr bool operator!=(iterator const& lhs, iterator const& rhs) noexcept
+            {
+                return !(lhs == rhs);
+            }
+
+        private:
+            friend class basic_split_view;
+
+            constexpr void find_stop() noexcept
+            {
+                size_type pos = string_view_type::npos;
+                if (_left != 1)
+                {
+                    if (_single)
+                        pos = _text.find(_character, _start);
+                    else if (!_separator.empty())
+                        pos = _text.find(_separator, _start);
+                }
+
+                _last = pos == string_view_type::npos;
+                _stop = _last ? _text.size() : pos;
+            }
+
+            string_view_type _text;
+            string_view_type _separator;
+            C                _character = C();
+            bool             _single    = false;
+            bool             _last      = true;
+            bool             _done      = true;
+            size_type        _start     = 0;
+            size_type        _stop      = 0;
+            std::size_t      _left      = 0;
+        };
+
+        constexpr basic_split_view() noexcept = default;
+
+        constexpr basic_split_view(string_view_type text, C seperator, std::size_t max_elements = 0) noexcept
+            : _text(text)
+            , _character(seperator)
+            , _single(true)
+            , _max_elements(max_elements)
+        {}
+
+        constexpr basic_split_view(string_view_type text, string_view_type seperator, std::size_t max_elements = 0) noexcept
+            : _text(text)
+            , _separator(seperator)
+            , _max_elements(max_elements)
+        {}
+
+        constexpr iterator begin() const noexcept
+        {
+            iterator it;
+            it._text      = _text;
+            it._separator = _separator;
+            it._character = _character;
+            it._single    = _single;
+            it._left      = _max_elements;
+            it._done      = false;
+            it.find_stop();
+            return it;
+        }
+
+        constexpr iterator end() const noexcept
+        {
+            return iterator{};
+        }
+
+    private:
+        string_view_type _text;
+        string_view_type _separator;
+        C                _character    = C();
+        bool             _single       = false;
+        std::size_t      _max_elements = 0;
+    };
+
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
+    constexpr basic_split_view<C, T> split_lazy(std::basic_string_view<C, T> s, C seperator, std::size_t max_elements = 0) noexcept
+    {
+        return {s, seperator, max_elements};
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename C, typename T = std::char_traits<C>>
+    constexpr basic_split_view<C, T> split_lazy(std::basic_string_view<C, T> s, std::basic_string_view<C, T> seperator, std::size_t max_elements = 0) noexcept
+    {
+        return {s, seperator, max_elements};
+    }
+
+    LJH_MODULE_STRING_EXPORT template<size_t S, typename C, typename T = std::char_traits<C>>
+    constexpr basic_split_view<C, T> split_lazy(std::basic_string_view<C, T> s, C const (&seperator)[S], std::size_t max_elements = 0) noexcept
+    {
+        return {s, std::basic_string_view<C, T>(seperator, S - 1), max_elements};
+    }
+#endif
+} // namespace ljh
+
+#if __cpp_lib_string_view >= 201606L && __has_include(<ranges>) && __cpp_lib_ranges
+template<typename C, typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<ljh::basic_split_view<C, T>> = true;
+
+template<typename C, typename T>
+inline constexpr bool std::ranges::enable_view<ljh::basic_split_view<C, T>> = true;
+
+namespace ljh::ranges::views
+{
+    // `text | split_lazy(',')` or `split_lazy(text, ", ")`, see `basic_split_view`.
+    LJH_MODULE_STRING_EXPORT inline constexpr adaptor split_lazy =
+        []<std::ranges::contiguous_range R, typename S>(R&& r, S const& seperator, std::size_t max_elements = 0)
+        requires(std::ranges::borrowed_range<R> || std::is_lvalue_reference_v<R>) &&
+                std::convertible_to<R, std::basic_string_view<std::remove_cv_t<std::ranges::range_value_t<R>>>>
+    {
+        using C = std::remove_cv_t<std::ranges::range_value_t<R>>;
+        return ljh::split_lazy(std::basic_string_view<C>(r), seperator, max_elements);
+    };
+} // namespace ljh::ranges::views
 #endif
-} // namespace ljh
\ No newline at end of file
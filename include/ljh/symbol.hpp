@@ -0,0 +1,156 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// symbol.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++17
+// Requires source/symbol.cpp
+//
+// ABOUT
+//     Interned strings
+//
+//     Every distinct string is stored once in a global, lock-free pool that lives for the
+//     rest of the program. A symbol is a pointer into that pool, so copying, comparing and
+//     hashing symbols never looks at the characters. Lookups never take a lock, inserting
+//     a new string costs one allocation and a compare exchange.
+//
+//     With C++20 `static_symbol<"text"_cts>` and `"text"_sym` are interned while the program
+//     starts, reading them afterwards is a plain load.
+//
+// USAGE
+//     ljh::symbol a = ljh::intern("method");
+//     ljh::symbol b{std::string_view{"method"}};
+//     a == b; // pointer comparison
+//
+//     using namespace ljh::symbol_literals;
+//     a == "method"_sym;
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#if __cpp_nontype_template_args >= 201911L
+#include "compile_time_string.hpp"
+#endif
+
+namespace _ljh
+{
+    struct symbol_entry
+    {
+        char const*   text;
+        std::size_t   size;
+        std::size_t   hash;
+        symbol_entry* next;
+    };
+
+    symbol_entry const* symbol_intern(std::string_view text);
+} // namespace _ljh
+
+namespace ljh
+{
+    LJH_MODULE_STRING_EXPORT class symbol
+    {
+        _ljh::symbol_entry const* _entry = nullptr;
+
+    public:
+        // The empty string
+        constexpr symbol() noexcept = default;
+
+        explicit symbol(std::string_view text)
+            : _entry(_ljh::symbol_intern(text))
+        {}
+
+        [[nodiscard]] std::string_view view() const noexcept
+        {
+            return _entry ? std::string_view{_entry->text, _entry->size} : std::string_view{};
+        }
+
+        // Always null terminated
+        [[nodiscard]] char const* c_str() const noexcept
+        {
+            return _entry ? _entry->text : "";
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return _entry ? _entry->size : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return _entry == nullptr;
+        }
+
+        // Stable for the life of the program, 0 is the empty string.
+        [[nodiscard]] std::uintptr_t id() const noexcept
+        {
+            return reinterpret_cast<std::uintptr_t>(_entry);
+        }
+
+        [[nodiscard]] explicit operator std::string_view() const noexcept
+        {
+            return view();
+        }
+
+        // Compares ids, not text.
+        [[nodiscard]] friend constexpr bool operator==(symbol lhs, symbol rhs) noexcept
+        {
+            return lhs._entry == rhs._entry;
+        }
+        [[nodiscard]] friend constexpr bool operator!=(symbol lhs, symbol rhs) noexcept
+        {
+            return lhs._entry != rhs._entry;
+        }
+        [[nodiscard]] friend bool operator<(symbol lhs, symbol rhs) noexcept
+        {
+            return std::less<_ljh::symbol_entry const*>{}(lhs._entry, rhs._entry);
+        }
+    };
+
+    LJH_MODULE_STRING_EXPORT inline symbol intern(std::string_view text)
+    {
+        return symbol{text};
+    }
+
+#if __cpp_nontype_template_args >= 201911L
+    LJH_MODULE_STRING_EXPORT template<compile_time_string text>
+    inline symbol const static_symbol{std::string_view(text)};
+
+    LJH_MODULE_STRING_EXPORT inline namespace symbol_literals
+    {
+        template<compile_time_string text>
+        [[nodiscard]] symbol operator""_sym() noexcept
+        {
+            static_assert(std::is_same_v<typename decltype(text)::char_type, char>, "symbols are narrow strings");
+            // Still empty when called from another static initializer that ran first
+            symbol s = static_symbol<text>;
+            return s.empty() ? symbol{std::string_view(text)} : s;
+        }
+    } // namespace symbol_literals
+#endif
+} // namespace ljh
+
+namespace std
+{
+    template<>
+    struct hash<ljh::symbol>
+    {
+        std::size_t operator()(ljh::symbol s) const noexcept
+        {
+            std::uint64_t id = s.id();
+            id *= 0x9E3779B97F4A7C15;
+            return static_cast<std::size_t>(id ^ (id >> 32));
+        }
+    };
+} // namespace std
@@ -4,18 +4,30 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// system_directories.hpp - v1.0
+// system_directories.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++
+// Requires source/system_directories.cpp
 //
 // ABOUT
 //     Functions for getting system directories.
 //
+//     The directories are looked up once and kept in a table, every function after that is
+//     a copy from the table. `cached()` returns the table itself so nothing is allocated.
+//
 // USAGE
+//     std::string const& documents = ljh::system_directories::cached().documents;
+//
+//     // Look everything up again the next time it is needed
+//     ljh::system_directories::invalidate();
+//
+//     // Call invalidate() whenever the user changes their directories, Linux only
+//     ljh::system_directories::watch_for_changes();
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add cached, invalidate and watch_for_changes
 
 #pragma once
 
@@ -26,6 +38,28 @@ namespace ljh
 {
     namespace system_directories
     {
+        LJH_MODULE_OS_EXPORT struct directory_table
+        {
+            std::string home;
+            std::string cache;
+            std::string config;
+            std::string data;
+            std::string documents;
+            std::string desktop;
+            std::string pictures;
+            std::string music;
+            std::string videos;
+            std::string downloads;
+            std::string save_games;
+        };
+
+        // Looked up on the first call. Tables replaced by invalidate() are never freed, so
+        // references stay valid for the rest of the program.
+        LJH_MODULE_OS_EXPORT directory_table const& cached();
+        LJH_MODULE_OS_EXPORT void invalidate();
+        // Returns false when changes can't be watched on this platform.
+        LJH_MODULE_OS_EXPORT bool watch_for_changes();
+
         LJH_MODULE_OS_EXPORT std::string home();
         LJH_MODULE_OS_EXPORT std::string cache();
         LJH_MODULE_OS_EXPORT std::string config();
@@ -38,4 +72,4 @@ namespace ljh
         LJH_MODULE_OS_EXPORT std::string downloads();
         LJH_MODULE_OS_EXPORT std::string save_games();
     } // namespace system_directories
-} // namespace ljh
\ No newline at end of file
+} // namespace ljh
\ No newline at end of file
@@ -4,7 +4,7 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// system_info.hpp - v1.0
+// system_info.hpp - v1.2
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++17
@@ -12,18 +12,32 @@
 // ABOUT
 //     System Info Collection
 //
+//     The get_* functions ask the OS every time they are called. snapshot() probes
+//     everything once, the first time it is called, and afterwards is a single atomic load.
+//
 // USAGE
+//     auto& info = ljh::system_info::snapshot();
+//     if (info.hardware) { threads = info.hardware->physical_cores; }
+//
+//     using ljh::system_info::cpu_feature;
+//     if (ljh::system_info::has_cpu_features(cpu_feature::avx2 | cpu_feature::bmi2)) { ... }
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Add get_hardware, snapshot and refresh
+//     1.2 Add cpu_features
 
 #pragma once
 
 #include "version.hpp"
 #include "expected.hpp"
+#include "bitmask_operators.hpp"
 #include "int_types.hpp"
 #include "os_build_info.hpp"
 
+#include <string>
+#include <vector>
+
 namespace ljh::system_info
 {
     LJH_MODULE_OS_EXPORT enum class error : ljh::int_types::u08
@@ -72,12 +86,113 @@ namespace ljh::system_info
         bool operator<=(ljh::u32 const&) const;
     };
 
+    LJH_MODULE_OS_EXPORT enum class cache_type : ljh::int_types::u08
+    {
+        unified,
+        data,
+        instruction,
+    };
+
+    LJH_MODULE_OS_EXPORT struct cache_info
+    {
+        u08        level{};
+        cache_type type{};
+        u64        size{};      // In bytes
+        u32        line_size{}; // In bytes
+    };
+
+    // Any count that could not be found is 0
+    LJH_MODULE_OS_EXPORT struct hardware_info
+    {
+        u32                     logical_cores{};
+        u32                     physical_cores{};
+        u32                     packages{};
+        u32                     numa_nodes{};
+        std::vector<cache_info> caches;         // Caches seen by the first core, ordered by level
+        u64                     page_size{};
+        u64                     huge_page_size{}; // 0 if huge pages are not supported
+        bool                    huge_pages{};     // Huge pages are reserved or transparent huge pages are enabled
+    };
+
+    // Instruction set extensions, only the ones for the architecture being run on are ever set.
+    // AVX and AVX-512 are only reported when the OS also saves their registers.
+    LJH_MODULE_OS_EXPORT enum class cpu_feature : ljh::int_types::u64
+    {
+        none = 0,
+
+        // x86 and x64
+        sse2       = 1ull << 0,
+        sse3       = 1ull << 1,
+        ssse3      = 1ull << 2,
+        sse4_1     = 1ull << 3,
+        sse4_2     = 1ull << 4,
+        popcnt     = 1ull << 5,
+        pclmul     = 1ull << 6,
+        avx        = 1ull << 7,
+        f16c       = 1ull << 8,
+        fma        = 1ull << 9,
+        avx2       = 1ull << 10,
+        bmi1       = 1ull << 11,
+        bmi2       = 1ull << 12,
+        lzcnt      = 1ull << 13,
+        avx512f    = 1ull << 14,
+        avx512dq   = 1ull << 15,
+        avx512bw   = 1ull << 16,
+        avx512vl   = 1ull << 17,
+        avx512vbmi = 1ull << 18,
+
+        // ARM
+        neon    = 1ull << 32,
+        crc32   = 1ull << 33,
+        lse     = 1ull << 34, // Large System Extensions atomics
+        dotprod = 1ull << 35,
+        sve     = 1ull << 36,
+        sve2    = 1ull << 37,
+
+        // Both
+        aes = 1ull << 48,
+        sha = 1ull << 49,
+    };
+} // namespace ljh::system_info
+
+template<>
+struct ljh::bitmask_operators::enable<ljh::system_info::cpu_feature> : std::true_type
+{};
+
+namespace ljh::system_info
+{
+
+    LJH_MODULE_OS_EXPORT struct snapshot_data
+    {
+        expected<ljh::system_info::platform, error> platform;
+        expected<ljh::version, error>               version;
+        expected<std::string, error>                string;
+        expected<u32, error>                        sdk;
+        expected<std::string, error>                model;
+        expected<std::string, error>                manufacturer;
+        expected<hardware_info, error>              hardware;
+    };
+
     LJH_MODULE_OS_EXPORT expected<platform, error> get_platform();        // Use for Version Check
     LJH_MODULE_OS_EXPORT expected<version, error> get_version();          // Use for Version Check
     LJH_MODULE_OS_EXPORT expected<std::string, error> get_string();       // Only use for Logs
     LJH_MODULE_OS_EXPORT expected<u32, error> get_sdk();                  // An infinitely increasing number
     LJH_MODULE_OS_EXPORT expected<std::string, error> get_model();        // Only use for Logs
     LJH_MODULE_OS_EXPORT expected<std::string, error> get_manufacturer(); // Only use for Logs
+    LJH_MODULE_OS_EXPORT expected<hardware_info, error> get_hardware();
+
+    // Detected once, on first use
+    LJH_MODULE_OS_EXPORT cpu_feature cpu_features();
+    LJH_MODULE_OS_EXPORT inline bool has_cpu_features(cpu_feature required)
+    {
+        return (cpu_features() & required) == required;
+    }
+
+    // Everything above, probed once on first use and thread safe. The reference stays valid
+    // for the life of the program, even after refresh.
+    LJH_MODULE_OS_EXPORT snapshot_data const& snapshot();
+    // Probes again and replaces the snapshot returned by later calls to snapshot().
+    LJH_MODULE_OS_EXPORT snapshot_data const& refresh();
 
     // OS Versions
     LJH_MODULE_OS_EXPORT inline namespace versions
@@ -391,4 +506,4 @@ namespace ljh::system_info
     LJH_MODULE_OS_EXPORT bool operator>(ljh::u32 const&, ljh::system_info::info_data const&);
     LJH_MODULE_OS_EXPORT bool operator>=(ljh::u32 const&, ljh::system_info::info_data const&);
     LJH_MODULE_OS_EXPORT bool operator<=(ljh::u32 const&, ljh::system_info::info_data const&);
-}; // namespace ljh::system_info
\ No newline at end of file
+}; // namespace ljh::system_info
\ No newline at end of file
@@ -0,0 +1,43 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// thread_slot.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++20
+//
+// ABOUT
+//     Internal helpers for types that spread one value over a cache line per thread slot
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <thread>
+
+namespace _ljh
+{
+    inline constexpr std::size_t cache_line_size = 64;
+
+    // A power of two, so a slot can be masked into a table of this size
+    inline std::size_t thread_slot_count() noexcept
+    {
+        static std::size_t const count = std::bit_ceil(std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, 256));
+        return count;
+    }
+
+    // Handed out round-robin the first time each thread asks, mask it with thread_slot_count() - 1
+    inline std::size_t thread_slot() noexcept
+    {
+        static std::atomic<std::size_t> next{0};
+        thread_local std::size_t const  slot = next.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+} // namespace _ljh
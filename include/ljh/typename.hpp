@@ -1,90 +1,140 @@
-
 //          Copyright Jared Irwin 2020-2026
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// type_traits.hpp - v1.0
+// typename.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
-// Requires C++11
+// Requires C++17
 // Requires cpp_version.hpp
 //
 // Based on code from https://stackoverflow.com/q/81870
 //
 // ABOUT
-//     Adds extra type traits
+//     Gets the name of a type at compile time
+//
+//     The name is trimmed out of the compiler's function signature once per type and kept in
+//     a static array, so `type_name` returns a view of it without allocating. `type_id` is a
+//     64 bit FNV-1a hash of that name, usable as a switch case or map key. Names, and so ids,
+//     are spelled the way each compiler prints them and only match between builds made with
+//     the same compiler.
 //
 // USAGE
+//     std::string_view name = ljh::type_name<std::vector<int>>();
+//
+//     switch (id)
+//     {
+//     case ljh::type_id<int>(): ...
+//     }
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Return static storage instead of a std::string, add type_id
 
 #pragma once
 
 #include "cpp_version.hpp"
 #include <cstdint>
 
-#if __cpp_lib_constexpr_string >= 201907L
-#include <string>
+#if LJH_CPP_VERSION >= LJH_CPP17_VERSION
+#include <array>
+#include <cstddef>
 #include <string_view>
-#include <tuple>
-#elif __cpp_lib_string_view >= 201606L
-#include <string_view>
-#endif
 
-namespace ljh
+namespace _ljh
 {
-    LJH_MODULE_MAIN_EXPORT template<typename T>
-    [[nodiscard]] constexpr auto type_name() noexcept
+    template<typename T>
+    constexpr std::string_view type_name_signature() noexcept
     {
-#if !(__cpp_lib_constexpr_string >= 201907L || __cpp_lib_string_view >= 201606L)
-        return "Error: unsupported C++ version";
-#else
-#if defined(LJH_COMPILER_CLANG)
-        constexpr char prefix_text[] = "auto ljh::type_name() [T = ";
-        constexpr char suffix_text[] = "]";
-#elif defined(LJH_COMPILER_GCC)
-        constexpr char prefix_text[] = "constexpr auto ljh::type_name() [with T = ";
-        constexpr char suffix_text[] = "]";
-#elif defined(LJH_COMPILER_MSVC)
-        constexpr char prefix_text[] = "auto __cdecl ljh::type_name<";
-        constexpr char suffix_text[] = ">(void) noexcept";
-#endif
-        constexpr std::size_t prefix = sizeof(prefix_text) - 1;
-        constexpr std::size_t suffix = sizeof(suffix_text) - 1;
+        return LJH_PRETTY_FUNCTION;
+    }
+
+    // Where the type sits in the signature, found from a type with a known name
+    inline constexpr std::string_view type_name_probe  = type_name_signature<double>();
+    inline constexpr std::size_t      type_name_prefix = type_name_probe.rfind("double");
+    inline constexpr std::size_t      type_name_suffix = type_name_probe.size() - type_name_prefix - (sizeof("double") - 1);
 
-#if __cpp_lib_constexpr_string >= 201907L
-        std::string name = LJH_PRETTY_FUNCTION;
-#elif __cpp_lib_string_view >= 201606L
-        std::string_view name = LJH_PRETTY_FUNCTION;
+    // Copies `name` to `output` when it isn't null, dropping the `struct `, `class `, `enum `
+    // and `union ` keywords MSVC puts in front of types. Returns the trimmed size.
+    constexpr std::size_t type_name_trim(std::string_view name, char* output) noexcept
+    {
+        std::size_t size = 0;
+        for (std::size_t a = 0; a < name.size();)
+        {
+#if defined(LJH_COMPILER_MSVC)
+            char previous = a == 0 ? ' ' : name[a - 1];
+            if (!((previous >= 'a' && previous <= 'z') || (previous >= 'A' && previous <= 'Z') || (previous >= '0' && previous <= '9') || previous == '_'))
+            {
+                std::size_t skip = 0;
+                for (std::string_view keyword : {std::string_view{"struct "}, std::string_view{"class "}, std::string_view{"enum "}, std::string_view{"union "}})
+                    if (name.substr(a, keyword.size()) == keyword)
+                        skip = keyword.size();
+                if (skip != 0)
+                {
+                    a += skip;
+                    continue;
+                }
+            }
 #endif
+            if (output != nullptr)
+                output[size] = name[a];
+            size++;
+            a++;
+        }
+        return size;
+    }
 
-        name = name.substr(prefix, name.size() - prefix - suffix);
+    template<typename T>
+    struct type_name_storage
+    {
+        static constexpr std::string_view signature = type_name_signature<T>();
+        static constexpr std::string_view raw       = signature.substr(type_name_prefix, signature.size() - type_name_prefix - type_name_suffix);
+        static constexpr std::size_t      size      = type_name_trim(raw, nullptr);
 
-#if defined(LJH_COMPILER_MSVC)
-#if __cpp_lib_constexpr_string >= 201907L
-        for (std::size_t a = 0; a < name.size(); a++)
+        static constexpr std::array<char, size + 1> text = []
         {
-            auto part = name.substr(a);
-            if (part.starts_with("struct "))
-                name.erase(a, 7);
-            else if (part.starts_with("class "))
-                name.erase(a, 6);
-            else if (part.starts_with("enum "))
-                name.erase(a, 5);
+            std::array<char, size + 1> text{};
+            type_name_trim(raw, text.data());
+            return text;
+        }();
+    };
+
+    constexpr std::uint64_t type_id_hash(std::string_view name) noexcept
+    {
+        std::uint64_t hash = 0xCBF29CE484222325;
+        for (char c : name)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3;
         }
-#elif __cpp_lib_string_view >= 201606L
-        if (part.starts_with("struct "))
-            name.remove_prefix(7);
-        else if (part.starts_with("class "))
-            name.remove_prefix(6);
-        else if (part.starts_with("enum "))
-            name.remove_prefix(5);
-#endif
+        return hash;
+    }
+} // namespace _ljh
 #endif
 
-        return name;
-#endif
+namespace ljh
+{
+#if LJH_CPP_VERSION >= LJH_CPP17_VERSION
+    // Null terminated, the view stays valid for the whole program.
+    LJH_MODULE_MAIN_EXPORT template<typename T>
+    [[nodiscard]] constexpr std::string_view type_name() noexcept
+    {
+        using storage = _ljh::type_name_storage<T>;
+        return {storage::text.data(), storage::size};
     }
-} // namespace ljh
\ No newline at end of file
+
+    LJH_MODULE_MAIN_EXPORT template<typename T>
+    [[nodiscard]] constexpr std::uint64_t type_id() noexcept
+    {
+        constexpr std::uint64_t id = _ljh::type_id_hash(type_name<T>());
+        return id;
+    }
+#else
+    LJH_MODULE_MAIN_EXPORT template<typename T>
+    [[nodiscard]] constexpr char const* type_name() noexcept
+    {
+        return "Error: unsupported C++ version";
+    }
+#endif
+} // namespace ljh
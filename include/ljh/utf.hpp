@@ -0,0 +1,330 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+// utf.hpp - v1.0
+// SPDX-License-Identifier: BSL-1.0
+//
+// Requires C++17
+//
+// ABOUT
+//     Locale independent UTF-8/UTF-16/UTF-32 transcoding and validation
+//
+//     The encoding is picked from the size of the character type, 1 byte is UTF-8,
+//     2 bytes is UTF-16 and 4 bytes is UTF-32. This makes wchar_t UTF-16 on Windows
+//     and UTF-32 everywhere else. Invalid input is replaced with U+FFFD, using the
+//     "maximal subpart" rule for UTF-8.
+//
+// USAGE
+//     std::u16string a = ljh::transcode<char16_t>(u8"text"sv);
+//
+//     char32_t buffer[64];
+//     auto res = ljh::transcode_into("text"sv, buffer, std::size(buffer));
+//     if (res.ec == std::errc::no_buffer_space) { /* res.in and res.out say where to continue */ }
+//
+// Version History
+//     1.0 Inital Version
+
+#pragma once
+#include "cpp_version.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace _ljh
+{
+    template<typename C>
+    constexpr std::uint32_t utf_unit(C c) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<C>>(c));
+    }
+
+    struct utf_decoded
+    {
+        char32_t    code_point;
+        std::size_t length;
+    };
+
+    inline constexpr char32_t utf_replacement = 0xFFFD;
+    inline constexpr char32_t utf_invalid     = 0xFFFF'FFFF;
+
+    template<typename In>
+    constexpr utf_decoded utf_decode(In const* in, In const* last) noexcept
+    {
+        std::uint32_t c0 = utf_unit(in[0]);
+
+        if constexpr (sizeof(In) == 1)
+        {
+            if (c0 < 0x80)
+                return {c0, 1};
+
+            std::size_t   need;
+            std::uint32_t cp;
+            std::uint32_t lo = 0x80;
+            std::uint32_t hi = 0xBF;
+
+            if (c0 >= 0xC2 && c0 <= 0xDF)
+            {
+                need = 1;
+                cp   = c0 & 0x1F;
+            }
+            else if (c0 >= 0xE0 && c0 <= 0xEF)
+            {
+                need = 2;
+                cp   = c0 & 0x0F;
+                lo   = c0 == 0xE0 ? 0xA0 : lo; // overlong
+                hi   = c0 == 0xED ? 0x9F : hi; // surrogates
+            }
+            else if (c0 >= 0xF0 && c0 <= 0xF4)
+            {
+                need = 3;
+                cp   = c0 & 0x07;
+                lo   = c0 == 0xF0 ? 0x90 : lo; // overlong
+                hi   = c0 == 0xF4 ? 0x8F : hi; // above U+10FFFF
+            }
+            else
+            {
+                return {utf_invalid, 1};
+            }
+
+            for (std::size_t a = 1; a <= need; a++)
+            {
+                if (in + a == last)
+                    return {utf_invalid, a};
+                std::uint32_t c = utf_unit(in[a]);
+                if (c < lo || c > hi)
+                    return {utf_invalid, a};
+                lo = 0x80;
+                hi = 0xBF;
+                cp = (cp << 6) | (c & 0x3F);
+            }
+            return {cp, need + 1};
+        }
+        else if constexpr (sizeof(In) == 2)
+        {
+            if (c0 < 0xD800 || c0 > 0xDFFF)
+                return {c0, 1};
+            if (c0 <= 0xDBFF && in + 1 != last)
+            {
+                std::uint32_t c1 = utf_unit(in[1]);
+                if (c1 >= 0xDC00 && c1 <= 0xDFFF)
+                    return {0x10000 + ((c0 - 0xD800) << 10) + (c1 - 0xDC00), 2};
+            }
+            return {utf_invalid, 1};
+        }
+        else
+        {
+            if (c0 > 0x10FFFF || (c0 >= 0xD800 && c0 <= 0xDFFF))
+                return {utf_invalid, 1};
+            return {c0, 1};
+        }
+    }
+
+    template<typename Out>
+    constexpr std::size_t utf_encoded_length(char32_t cp) noexcept
+    {
+        cp = cp == utf_invalid ? utf_replacement : cp;
+        if constexpr (sizeof(Out) == 1)
+            return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+        else if constexpr (sizeof(Out) == 2)
+            return cp < 0x10000 ? 1 : 2;
+        else
+            return 1;
+    }
+
+    template<typename Out>
+    constexpr Out* utf_encode(char32_t cp, Out* out) noexcept
+    {
+        cp = cp == utf_invalid ? utf_replacement : cp;
+        if constexpr (sizeof(Out) == 1)
+        {
+            if (cp < 0x80)
+            {
+                *out++ = Out(cp);
+            }
+            else if (cp < 0x800)
+            {
+                *out++ = Out(0xC0 | (cp >> 6));
+                *out++ = Out(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000)
+            {
+                *out++ = Out(0xE0 | (cp >> 12));
+                *out++ = Out(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = Out(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                *out++ = Out(0xF0 | (cp >> 18));
+                *out++ = Out(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = Out(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = Out(0x80 | (cp & 0x3F));
+            }
+        }
+        else if constexpr (sizeof(Out) == 2)
+        {
+            if (cp < 0x10000)
+            {
+                *out++ = Out(cp);
+            }
+            else
+            {
+                *out++ = Out(0xD800 + ((cp - 0x10000) >> 10));
+                *out++ = Out(0xDC00 + ((cp - 0x10000) & 0x3FF));
+            }
+        }
+        else
+        {
+            *out++ = Out(cp);
+        }
+        return out;
+    }
+
+    // Number of leading ascii code units in [in, last), checked 8 at a time where possible.
+    template<typename In>
+    inline std::size_t utf_ascii_prefix(In const* in, In const* last) noexcept
+    {
+        In const* p = in;
+        if constexpr (sizeof(In) == 1)
+        {
+            while (last - p >= 8)
+            {
+                std::uint64_t word;
+                std::memcpy(&word, p, 8);
+                if (word & 0x8080808080808080)
+                    break;
+                p += 8;
+            }
+        }
+        else
+        {
+            while (last - p >= 8)
+            {
+                std::uint32_t bits = 0;
+                for (int a = 0; a < 8; a++)
+                    bits |= utf_unit(p[a]);
+                if (bits >= 0x80)
+                    break;
+                p += 8;
+            }
+        }
+        while (p != last && utf_unit(*p) < 0x80)
+            p++;
+        return std::size_t(p - in);
+    }
+} // namespace _ljh
+
+namespace ljh
+{
+    LJH_MODULE_STRING_EXPORT template<typename In, typename Out>
+    struct transcode_result
+    {
+        In const* in;
+        Out*      out;
+        std::errc ec;
+    };
+
+    // Returns the index of the first invalid code unit sequence, or npos if `text` is valid.
+    LJH_MODULE_STRING_EXPORT template<typename In, typename T>
+    std::size_t find_invalid_utf(std::basic_string_view<In, T> text) noexcept
+    {
+        In const* first = text.data();
+        In const* last  = first + text.size();
+        In const* in    = first;
+        while (in != last)
+        {
+            in += _ljh::utf_ascii_prefix(in, last);
+            if (in == last)
+                break;
+            auto d = _ljh::utf_decode(in, last);
+            if (d.code_point == _ljh::utf_invalid)
+                return std::size_t(in - first);
+            in += d.length;
+        }
+        return std::basic_string_view<In, T>::npos;
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename In, typename T>
+    bool is_valid_utf(std::basic_string_view<In, T> text) noexcept
+    {
+        return find_invalid_utf(text) == std::basic_string_view<In, T>::npos;
+    }
+
+    // Number of `Out` code units `text` needs once transcoded.
+    LJH_MODULE_STRING_EXPORT template<typename Out, typename In, typename T>
+    std::size_t transcoded_length(std::basic_string_view<In, T> text) noexcept
+    {
+        In const*   in     = text.data();
+        In const*   last   = in + text.size();
+        std::size_t length = 0;
+        while (in != last)
+        {
+            std::size_t ascii = _ljh::utf_ascii_prefix(in, last);
+            in += ascii;
+            length += ascii;
+            if (in == last)
+                break;
+            auto d = _ljh::utf_decode(in, last);
+            in += d.length;
+            length += _ljh::utf_encoded_length<Out>(d.code_point);
+        }
+        return length;
+    }
+
+    // Transcodes into a caller provided buffer without allocating. Stops before the first
+    // code point that does not fit, returning std::errc::no_buffer_space.
+    LJH_MODULE_STRING_EXPORT template<typename In, typename T, typename Out>
+    transcode_result<In, Out> transcode_into(std::basic_string_view<In, T> text, Out* buffer, std::size_t capacity) noexcept
+    {
+        In const* in       = text.data();
+        In const* last     = in + text.size();
+        Out*      out      = buffer;
+        Out*      out_last = buffer + capacity;
+
+        while (in != last)
+        {
+            std::size_t ascii = _ljh::utf_ascii_prefix(in, last);
+            if (ascii > std::size_t(out_last - out))
+                ascii = std::size_t(out_last - out);
+            for (std::size_t a = 0; a < ascii; a++)
+                out[a] = Out(_ljh::utf_unit(in[a]));
+            in += ascii;
+            out += ascii;
+            if (in == last)
+                break;
+
+            auto d = _ljh::utf_decode(in, last);
+            if (_ljh::utf_encoded_length<Out>(d.code_point) > std::size_t(out_last - out))
+                return {in, out, std::errc::no_buffer_space};
+            out = _ljh::utf_encode(d.code_point, out);
+            in += d.length;
+        }
+        return {in, out, std::errc{}};
+    }
+
+    // Transcodes `text` with a single allocation.
+    LJH_MODULE_STRING_EXPORT template<typename Out, typename In, typename T>
+    std::basic_string<Out> transcode(std::basic_string_view<In, T> text)
+    {
+        std::basic_string<Out> output;
+        output.resize(transcoded_length<Out>(text));
+        transcode_into(text, output.data(), output.size());
+        return output;
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename Out, typename In, typename T, typename A>
+    std::basic_string<Out> transcode(std::basic_string<In, T, A> const& text)
+    {
+        return transcode<Out>(std::basic_string_view<In, T>(text));
+    }
+
+    LJH_MODULE_STRING_EXPORT template<typename Out, typename In>
+    std::basic_string<Out> transcode(In const* text)
+    {
+        return transcode<Out>(std::basic_string_view<In>(text));
+    }
+} // namespace ljh
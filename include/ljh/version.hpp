@@ -4,18 +4,31 @@
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
-// version.hpp - v1.0
+// version.hpp - v1.1
 // SPDX-License-Identifier: BSL-1.0
 //
 // Requires C++17
 // Requires type_traits.hpp and char_convertions.hpp and cpp_version.hpp
 //
 // ABOUT
+//     Four part versions (major.minor.build.revision) and sets of version ranges
+//
+//     A version is stored as two packed 64 bit keys (major:minor and build:revision) so
+//     comparing two versions is at most two integer compares.
 //
 // USAGE
+//     constexpr ljh::version v{"10.0.19041"};
+//
+//     ljh::version parsed;
+//     auto [ptr, ec] = ljh::from_chars(text.data(), text.data() + text.size(), parsed);
+//
+//     ljh::version_range_set supported;
+//     supported.insert({{1, 0}, {1, 9}});
+//     supported.contains({1, 4}); // true
 //
 // Version History
 //     1.0 Inital Version
+//     1.1 Single pass constexpr parser with error reporting, packed storage and version_range_set
 
 #pragma once
 
@@ -23,9 +36,14 @@
 #include "type_traits.hpp"
 #include "char_convertions.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
 #include <string>
 #include <string_view>
+#include <vector>
 #if LJH_CPP_VERSION > LJH_CPP17_VERSION
 #if __has_include(<compare>)
 #include <compare>
@@ -64,35 +82,11 @@ namespace ljh
         static constexpr value_type min_value = std::numeric_limits<value_type>::min();
         static constexpr value_type max_value = std::numeric_limits<value_type>::max();
 
+        // Parses as much of `text` as is a version, see ljh::from_chars for error reporting.
         template<class _char, class _traits = std::char_traits<_char>>
-        version(std::basic_string_view<_char, _traits> text)
-        {
-            constexpr auto npos = std::basic_string_view<_char, _traits>::npos;
-            // clang-format off
-            auto dot_pos = text.find('.');
-            auto sub = text.substr(0, dot_pos);
-            from_string(_major, sub);
-            if (dot_pos == npos) return;
-            text = text.substr(dot_pos + 1);
-
-            dot_pos = text.find('.');
-            sub = text.substr(0, dot_pos);
-            from_string(_minor, sub);
-            if (dot_pos == npos) return;
-            text = text.substr(dot_pos + 1);
-
-            dot_pos = text.find('.');
-            sub = text.substr(0, dot_pos);
-            from_string(_build, sub);
-            if (dot_pos == npos) return;
-            text = text.substr(dot_pos + 1);
-
-            dot_pos = text.find('.');
-            sub = text.substr(0, dot_pos);
-            from_string(_revision, sub);
-            if (dot_pos == npos) return;
-            text = text.substr(dot_pos + 1);
-            // clang-format on
+        constexpr version(std::basic_string_view<_char, _traits> text)
+        {
+            from_chars(text.data(), text.data() + text.size(), *this);
         }
 
         template<class _char, class _traits = std::char_traits<_char>, class _alloc = std::allocator<_char>>
@@ -101,62 +95,43 @@ namespace ljh
         {}
 
         template<typename _char, typename = typename std::enable_if_t<is_char_type_v<_char>>>
-        version(_char const* text)
+        constexpr version(_char const* text)
             : version(std::basic_string_view{text})
         {}
 
         constexpr version(value_type major = 0, value_type minor = 0, value_type build = 0, value_type revision = 0)
-            : _major(major)
-            , _minor(minor)
-            , _build(build)
-            , _revision(revision)
+            : _high(_pack(major, minor))
+            , _low(_pack(build, revision))
         {}
 
         constexpr version(limit::max_t, value_type major = max_value, value_type minor = max_value, value_type build = max_value,
                           value_type revision = max_value)
-            : _major(major)
-            , _minor(minor)
-            , _build(build)
-            , _revision(revision)
+            : _high(_pack(major, minor))
+            , _low(_pack(build, revision))
         {}
 
         constexpr version(limit::min_t, value_type major = min_value, value_type minor = min_value, value_type build = min_value,
                           value_type revision = min_value)
-            : _major(major)
-            , _minor(minor)
-            , _build(build)
-            , _revision(revision)
+            : _high(_pack(major, minor))
+            , _low(_pack(build, revision))
         {}
 
 #ifdef LJH_HAS_CPP20_COMPARISON
         constexpr std::strong_ordering operator<=>(const version& rhs) const
         {
-            // clang-format off
-            if (auto cmp = _major <=> rhs._major; cmp != std::strong_ordering::equal) { return cmp; }
-            if (auto cmp = _minor <=> rhs._minor; cmp != std::strong_ordering::equal) { return cmp; }
-            if (auto cmp = _build <=> rhs._build; cmp != std::strong_ordering::equal) { return cmp; }
-            return _revision <=> rhs._revision;
-            // clang-format on
+            if (auto cmp = _high <=> rhs._high; cmp != std::strong_ordering::equal)
+                return cmp;
+            return _low <=> rhs._low;
         }
         constexpr bool operator==(version const&) const = default;
 #else
         constexpr bool operator==(const version& rhs) const
         {
-            // clang-format off
-            if (_major != rhs._major) { return false; }
-            if (_minor != rhs._minor) { return false; }
-            if (_build != rhs._build) { return false; }
-            return _revision == rhs._revision;
-            // clang-format on
+            return _high == rhs._high && _low == rhs._low;
         }
         constexpr bool operator<(version const& rhs) const
         {
-            // clang-format off
-            if (_major < rhs._major) { return true; }
-            if (_minor < rhs._minor) { return true; }
-            if (_build < rhs._build) { return true; }
-            return _revision < rhs._revision;
-            // clang-format on
+            return _high < rhs._high || (_high == rhs._high && _low < rhs._low);
         }
         constexpr bool operator!=(version const& rhs) const
         {
@@ -178,19 +153,19 @@ namespace ljh
 
         constexpr auto major() const
         {
-            return _major;
+            return value_type(_high >> 32);
         };
         constexpr auto minor() const
         {
-            return _minor;
+            return value_type(_high);
         };
         constexpr auto build() const
         {
-            return _build;
+            return value_type(_low >> 32);
         };
         constexpr auto revision() const
         {
-            return _revision;
+            return value_type(_low);
         };
 
         operator std::string() const
@@ -199,10 +174,153 @@ namespace ljh
         }
 
     private:
-        value_type _major    = 0;
-        value_type _minor    = 0;
-        value_type _build    = 0;
-        value_type _revision = 0;
+        static_assert(sizeof(value_type) == 4, "version packs two parts into each 64 bit key");
+
+        static constexpr std::uint64_t _pack(value_type high, value_type low)
+        {
+            return (std::uint64_t(high) << 32) | low;
+        }
+
+        std::uint64_t _high = 0;
+        std::uint64_t _low  = 0;
+    };
+
+    // Parses up to four dot separated parts in a single pass, missing or empty parts are 0.
+    // Stops at the first character that is not part of the version, which `ptr` points to.
+    // Returns std::errc::invalid_argument if `first` does not start with a digit or a dot and
+    // std::errc::result_out_of_range if a part does not fit in version::value_type.
+    LJH_MODULE_MAIN_EXPORT template<typename _char>
+    constexpr std::enable_if_t<is_char_type_v<_char>, from_chars_result<_char>> from_chars(_char const* first, _char const* last, version& value) noexcept
+    {
+        if (first == last || !(*first == '.' || (*first >= '0' && *first <= '9')))
+            return {first, std::errc::invalid_argument};
+
+        version::value_type parts[4] = {};
+        _char const*        p        = first;
+        for (int a = 0; a < 4; a++)
+        {
+            auto res = ljh::from_chars(p, last, parts[a]);
+            if (res.ec == std::errc::result_out_of_range)
+                return res;
+            if (res.ec == std::errc{})
+                p = res.ptr;
+            if (a == 3 || p == last || *p != '.')
+                break;
+            p++;
+        }
+        value = version{parts[0], parts[1], parts[2], parts[3]};
+        return {p, std::errc{}};
+    }
+
+    // Inclusive range of versions.
+    LJH_MODULE_MAIN_EXPORT struct version_range
+    {
+        version first;
+        version last;
+
+        constexpr bool contains(version const& v) const
+        {
+            return !(v < first) && !(last < v);
+        }
+    };
+
+    // Sorted set of disjoint version ranges, overlapping ranges are merged when inserted.
+    // Lookups are a binary search over the range starts.
+    LJH_MODULE_MAIN_EXPORT class version_range_set
+    {
+        std::vector<version_range> _ranges;
+
+        auto _upper_bound(version const& v) const
+        {
+            return std::upper_bound(_ranges.begin(), _ranges.end(), v, [](version const& lhs, version_range const& rhs) { return lhs < rhs.first; });
+        }
+
+    public:
+        using const_iterator = std::vector<version_range>::const_iterator;
+
+        version_range_set() = default;
+        version_range_set(std::initializer_list<version_range> ranges)
+        {
+            for (auto& range : ranges)
+                insert(range);
+        }
+
+        void insert(version_range range)
+        {
+            if (range.last < range.first)
+                return;
+
+            auto first = _upper_bound(range.first);
+            if (first != _ranges.begin() && !(std::prev(first)->last < range.first))
+                --first;
+            auto last = first;
+            while (last != _ranges.end() && !(range.last < last->first))
+            {
+                range.first = std::min(range.first, last->first);
+                range.last  = std::max(range.last, last->last);
+                ++last;
+            }
+            first = _ranges.erase(first, last);
+            _ranges.insert(first, range);
+        }
+
+        // The range containing `v`, or nullptr.
+        version_range const* find(version const& v) const
+        {
+            auto it = _upper_bound(v);
+            if (it == _ranges.begin() || std::prev(it)->last < v)
+                return nullptr;
+            return &*std::prev(it);
+        }
+
+        bool contains(version const& v) const
+        {
+            return find(v) != nullptr;
+        }
+
+        // Answers `contains` for every version in [first, last). Sorted input is answered with
+        // a single merge pass over the ranges instead of a binary search each.
+        template<typename _it, typename _out>
+        _out contains(_it first, _it last, _out out) const
+        {
+            if (std::is_sorted(first, last))
+            {
+                auto range = _ranges.begin();
+                for (; first != last; ++first, ++out)
+                {
+                    while (range != _ranges.end() && range->last < *first)
+                        ++range;
+                    *out = range != _ranges.end() && range->contains(*first);
+                }
+            }
+            else
+            {
+                for (; first != last; ++first, ++out)
+                    *out = contains(*first);
+            }
+            return out;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return _ranges.begin();
+        }
+        const_iterator end() const noexcept
+        {
+            return _ranges.end();
+        }
+        std::size_t size() const noexcept
+        {
+            return _ranges.size();
+        }
+        bool empty() const noexcept
+        {
+            return _ranges.empty();
+        }
+        void clear() noexcept
+        {
+            _ranges.clear();
+        }
     };
 } // namespace ljh
 
@@ -211,4 +329,4 @@ std::basic_ostream<T, std::char_traits<T>>& operator<<(std::basic_ostream<T, std
 {
     os << static_cast<std::string>(version);
     return os;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -14,12 +14,15 @@ extern "C++"
 #include "ljh/casting.hpp"
 #include "ljh/concepts.hpp"
 #include "ljh/defer.hpp"
+#include "ljh/dispatch.hpp"
 #include "ljh/enum_array.hpp"
 #include "ljh/expected.hpp"
+#include "ljh/function.hpp"
 #include "ljh/function_traits.hpp"
 #include "ljh/function_pointer.hpp"
 #include "ljh/get_index.hpp"
 #include "ljh/int_types.hpp"
+#include "ljh/metrics.hpp"
 #include "ljh/overload.hpp"
 #include "ljh/version.hpp"
 #include "ljh/typename.hpp"
@@ -15,5 +15,6 @@ extern "C++"
 #include "ljh/system_directories.hpp"
 #include "ljh/named_mutex.hpp"
 #include "ljh/memory_mapped_file.hpp"
+#include "ljh/ipc_ring.hpp"
 #include "ljh/delay_loaded_functions.hpp"
 }
\ No newline at end of file
@@ -12,7 +12,10 @@ extern "C++"
 {
 #include "ljh/string_utils.hpp"
 #include "ljh/compile_time_string.hpp"
+#include "ljh/string_switch.hpp"
 #include "ljh/char_convertions.hpp"
 #include "ljh/case_insensitive_string.hpp"
 #include "ljh/byte_constant.hpp"
-}
\ No newline at end of file
+#include "ljh/utf.hpp"
+#include "ljh/symbol.hpp"
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "ljh/system_info.hpp"
 #include "ljh/char_convertions.hpp"
 #include <sys/system_properties.h>
+#include <unistd.h>
 
 using namespace ljh::int_types;
 
@@ -69,6 +70,14 @@ ljh::expected<std::string, ljh::system_info::error> ljh::system_info::get_manufa
 	return get_system_prop("ro.product.manufacturer");
 }
 
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	hardware_info info;
+	info.page_size     = u64(sysconf(_SC_PAGESIZE));
+	info.logical_cores = u32(sysconf(_SC_NPROCESSORS_ONLN));
+	return info;
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
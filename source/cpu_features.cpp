@@ -0,0 +1,178 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/system_info.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LJH_CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM64EC)
+#define LJH_CPU_ARM64
+#if defined(LJH_TARGET_Windows)
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(LJH_TARGET_MacOS) || defined(LJH_TARGET_iOS)
+#include <sys/sysctl.h>
+#elif defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Android)
+#include <sys/auxv.h>
+#endif
+#endif
+
+using ljh::system_info::cpu_feature;
+
+#if defined(LJH_CPU_X86)
+struct cpuid_registers
+{
+	unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+};
+
+static cpuid_registers cpuid(unsigned int leaf, unsigned int subleaf = 0)
+{
+	cpuid_registers r;
+#if defined(_MSC_VER)
+	int values[4];
+	__cpuidex(values, int(leaf), int(subleaf));
+	r = {unsigned(values[0]), unsigned(values[1]), unsigned(values[2]), unsigned(values[3])};
+#else
+	__cpuid_count(leaf, subleaf, r.eax, r.ebx, r.ecx, r.edx);
+#endif
+	return r;
+}
+
+// Which register states the OS saves on a context switch
+static ljh::u64 xgetbv()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	unsigned int eax, edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (ljh::u64(edx) << 32) | eax;
+#endif
+}
+
+static cpu_feature detect()
+{
+	cpu_feature features = cpu_feature::none;
+	auto add = [&](bool present, cpu_feature feature) {
+		if (present)
+			features |= feature;
+	};
+	auto bit = [](unsigned int value, int index) { return ((value >> index) & 1) != 0; };
+
+	unsigned int max_leaf = cpuid(0).eax;
+	if (max_leaf < 1)
+		return features;
+
+	auto leaf1 = cpuid(1);
+	add(bit(leaf1.edx, 26), cpu_feature::sse2);
+	add(bit(leaf1.ecx, 0), cpu_feature::sse3);
+	add(bit(leaf1.ecx, 1), cpu_feature::pclmul);
+	add(bit(leaf1.ecx, 9), cpu_feature::ssse3);
+	add(bit(leaf1.ecx, 19), cpu_feature::sse4_1);
+	add(bit(leaf1.ecx, 20), cpu_feature::sse4_2);
+	add(bit(leaf1.ecx, 23), cpu_feature::popcnt);
+	add(bit(leaf1.ecx, 25), cpu_feature::aes);
+
+	bool     osxsave = bit(leaf1.ecx, 27);
+	ljh::u64 xcr0    = osxsave ? xgetbv() : 0;
+	bool     ymm     = (xcr0 & 0x06) == 0x06; // SSE and AVX state
+	bool     zmm     = (xcr0 & 0xE6) == 0xE6; // and opmask, upper ZMM and high ZMM state
+
+	add(ymm && bit(leaf1.ecx, 28), cpu_feature::avx);
+	add(ymm && bit(leaf1.ecx, 29), cpu_feature::f16c);
+	add(ymm && bit(leaf1.ecx, 12), cpu_feature::fma);
+
+	if (max_leaf >= 7)
+	{
+		auto leaf7 = cpuid(7, 0);
+		add(bit(leaf7.ebx, 3), cpu_feature::bmi1);
+		add(bit(leaf7.ebx, 8), cpu_feature::bmi2);
+		add(bit(leaf7.ebx, 29), cpu_feature::sha);
+		add(ymm && bit(leaf7.ebx, 5), cpu_feature::avx2);
+		add(zmm && bit(leaf7.ebx, 16), cpu_feature::avx512f);
+		add(zmm && bit(leaf7.ebx, 17), cpu_feature::avx512dq);
+		add(zmm && bit(leaf7.ebx, 30), cpu_feature::avx512bw);
+		add(zmm && bit(leaf7.ebx, 31), cpu_feature::avx512vl);
+		add(zmm && bit(leaf7.ecx, 1), cpu_feature::avx512vbmi);
+	}
+
+	if (cpuid(0x80000000).eax >= 0x80000001)
+		add(bit(cpuid(0x80000001).ecx, 5), cpu_feature::lzcnt);
+
+	return features;
+}
+#elif defined(LJH_CPU_ARM64)
+#if defined(LJH_TARGET_MacOS) || defined(LJH_TARGET_iOS)
+static bool sysctl_flag(char const* name)
+{
+	int    value = 0;
+	size_t size  = sizeof(value);
+	return sysctlbyname(name, &value, &size, nullptr, 0) == 0 && value != 0;
+}
+#endif
+
+static cpu_feature detect()
+{
+	// Advanced SIMD is part of the ARMv8-A base
+	cpu_feature features = cpu_feature::neon;
+	auto add = [&](bool present, cpu_feature feature) {
+		if (present)
+			features |= feature;
+	};
+
+#if defined(LJH_TARGET_Windows)
+	add(IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE), cpu_feature::crc32);
+	add(IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE), cpu_feature::aes | cpu_feature::sha);
+#if defined(PF_ARM_V81_ATOMIC_INSTRUCTIONS_AVAILABLE)
+	add(IsProcessorFeaturePresent(PF_ARM_V81_ATOMIC_INSTRUCTIONS_AVAILABLE), cpu_feature::lse);
+#endif
+#if defined(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE)
+	add(IsProcessorFeaturePresent(PF_ARM_V82_DP_INSTRUCTIONS_AVAILABLE), cpu_feature::dotprod);
+#endif
+#elif defined(LJH_TARGET_MacOS) || defined(LJH_TARGET_iOS)
+	add(sysctl_flag("hw.optional.armv8_crc32"), cpu_feature::crc32);
+	add(sysctl_flag("hw.optional.arm.FEAT_AES"), cpu_feature::aes);
+	add(sysctl_flag("hw.optional.arm.FEAT_SHA256"), cpu_feature::sha);
+	add(sysctl_flag("hw.optional.armv8_1_atomics"), cpu_feature::lse);
+	add(sysctl_flag("hw.optional.arm.FEAT_DotProd"), cpu_feature::dotprod);
+#elif defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Android)
+	// Bits from the kernel's asm/hwcap.h
+	unsigned long hwcap  = getauxval(AT_HWCAP);
+	unsigned long hwcap2 = getauxval(AT_HWCAP2);
+	add(hwcap & (1ul << 3), cpu_feature::aes);
+	add(hwcap & (1ul << 6), cpu_feature::sha);
+	add(hwcap & (1ul << 7), cpu_feature::crc32);
+	add(hwcap & (1ul << 8), cpu_feature::lse);
+	add(hwcap & (1ul << 20), cpu_feature::dotprod);
+	add(hwcap & (1ul << 22), cpu_feature::sve);
+	add(hwcap2 & (1ul << 1), cpu_feature::sve2);
+#endif
+
+	return features;
+}
+#else
+static cpu_feature detect()
+{
+#if defined(__ARM_NEON)
+	return cpu_feature::neon;
+#else
+	return cpu_feature::none;
+#endif
+}
+#endif
+
+ljh::system_info::cpu_feature ljh::system_info::cpu_features()
+{
+	static cpu_feature const features = detect();
+	return features;
+}
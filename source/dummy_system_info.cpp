@@ -39,4 +39,9 @@ ljh::expected<std::string, ljh::system_info::error> ljh::system_info::get_manufa
 	return unexpected{error::unknown_os};
 }
 
-#endif
\ No newline at end of file
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	return unexpected{error::unknown_os};
+}
+
+#endif
\ No newline at end of file
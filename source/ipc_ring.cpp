@@ -0,0 +1,51 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/ipc_ring.hpp"
+#include "ljh/os_build_info.hpp"
+
+#if defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Android)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <algorithm>
+#include <thread>
+#endif
+
+#if defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Android)
+// Not FUTEX_PRIVATE_FLAG, the word is shared with other processes
+void _ljh::ipc_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::int64_t timeout_nanoseconds) noexcept
+{
+	timespec timeout{time_t(timeout_nanoseconds / 1'000'000'000), long(timeout_nanoseconds % 1'000'000'000)};
+	syscall(SYS_futex, &word, FUTEX_WAIT, expected, timeout_nanoseconds < 0 ? nullptr : &timeout, nullptr, 0);
+}
+
+void _ljh::ipc_wake_all(std::atomic<std::uint32_t>& word) noexcept
+{
+	syscall(SYS_futex, &word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+#else
+// WaitOnAddress and std::atomic::wait only wake threads in the same process, so sleep in
+// short steps instead, checking the word in between.
+void _ljh::ipc_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::int64_t timeout_nanoseconds) noexcept
+{
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds{timeout_nanoseconds < 0 ? INT64_MAX / 2 : timeout_nanoseconds};
+	auto backoff  = std::chrono::microseconds{20};
+	while (word.load(std::memory_order_acquire) == expected)
+	{
+		auto now = std::chrono::steady_clock::now();
+		if (now >= deadline)
+			return;
+		std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(backoff, deadline - now));
+		backoff = std::min(backoff * 2, std::chrono::microseconds{1000});
+	}
+}
+
+void _ljh::ipc_wake_all(std::atomic<std::uint32_t>&) noexcept
+{}
+#endif
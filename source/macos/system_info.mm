@@ -16,6 +16,7 @@
 
 #include <TargetConditionals.h>
 #include <string>
+#include <sys/sysctl.h>
 #include <sys/utsname.h>
 #include "ljh/version.hpp"
 
@@ -125,6 +126,38 @@ ljh::expected<std::string, ljh::system_info::error> ljh::system_info::get_manufa
 	return "Apple";
 }
 
+// Apple only runs little endian, so a 32 bit value read into a zeroed 64 bit one is still correct
+static ljh::u64 sysctl_value(char const* name)
+{
+	ljh::u64 value = 0;
+	size_t   size  = sizeof(value);
+	if (sysctlbyname(name, &value, &size, nullptr, 0) != 0)
+		return 0;
+	return value;
+}
+
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	hardware_info info;
+	info.logical_cores  = u32(sysctl_value("hw.logicalcpu"));
+	info.physical_cores = u32(sysctl_value("hw.physicalcpu"));
+	info.packages       = u32(sysctl_value("hw.packages"));
+	info.numa_nodes     = 1;
+	info.page_size      = sysctl_value("hw.pagesize");
+
+	auto line_size = u32(sysctl_value("hw.cachelinesize"));
+	auto add_cache = [&](u08 level, cache_type type, char const* name) {
+		if (auto size = sysctl_value(name))
+			info.caches.push_back({level, type, size, line_size});
+	};
+	add_cache(1, cache_type::data, "hw.l1dcachesize");
+	add_cache(1, cache_type::instruction, "hw.l1icachesize");
+	add_cache(2, cache_type::unified, "hw.l2cachesize");
+	add_cache(3, cache_type::unified, "hw.l3cachesize");
+
+	return info;
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
@@ -178,7 +178,7 @@ ljh::memory_mapped::view::view(file& fd, permissions permissions, size_t start,
 	auto page_size = sysconf(_SC_PAGESIZE);
 
 	offset = start % page_size;
-	start = floor(start / page_size) * page_size;
+	start = (start / page_size) * page_size;
 	length += offset;
 
 	data = mmap(nullptr, length, prot, flags, fd.file_descriptor, start);
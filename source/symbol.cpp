@@ -0,0 +1,69 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/symbol.hpp"
+#include <atomic>
+#include <cstring>
+#include <new>
+
+namespace
+{
+	// Buckets are never resized, each one is a list that only grows at its head, so
+	// a reader that loaded a head can walk the list without any synchronisation.
+	constexpr std::size_t bucket_count = 1 << 12;
+	constinit std::atomic<_ljh::symbol_entry*> buckets[bucket_count] = {};
+
+	std::size_t hash_text(std::string_view text)
+	{
+		std::uint64_t hash = 0xCBF29CE484222325;
+		for (char c : text)
+			hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3;
+		return static_cast<std::size_t>(hash ^ (hash >> 32));
+	}
+
+	_ljh::symbol_entry* find(_ljh::symbol_entry* first, _ljh::symbol_entry* last, std::string_view text, std::size_t hash)
+	{
+		for (; first != last; first = first->next)
+			if (first->hash == hash && std::string_view{first->text, first->size} == text)
+				return first;
+		return nullptr;
+	}
+}
+
+namespace _ljh
+{
+	symbol_entry const* symbol_intern(std::string_view text)
+	{
+		if (text.empty())
+			return nullptr;
+
+		std::size_t   hash  = hash_text(text);
+		auto&         head  = buckets[hash % bucket_count];
+		symbol_entry* first = head.load(std::memory_order_acquire);
+		if (auto entry = find(first, nullptr, text, hash))
+			return entry;
+
+		// The text is stored right after the entry
+		auto  memory = static_cast<char*>(::operator new(sizeof(symbol_entry) + text.size() + 1));
+		auto  chars  = memory + sizeof(symbol_entry);
+		std::memcpy(chars, text.data(), text.size());
+		chars[text.size()] = '\0';
+		auto entry = new (memory) symbol_entry{chars, text.size(), hash, first};
+
+		for (symbol_entry* seen = first;; seen = first)
+		{
+			entry->next = first;
+			if (head.compare_exchange_weak(first, entry, std::memory_order_release, std::memory_order_acquire))
+				return entry;
+
+			// Another thread got in first, only the entries it added need checking.
+			if (auto other = find(first, seen, text, hash))
+			{
+				::operator delete(memory);
+				return other;
+			}
+		}
+	}
+}
@@ -6,6 +6,8 @@
 
 #include "ljh/system_directories.hpp"
 #include "ljh/system_info.hpp"
+#include <atomic>
+#include <mutex>
 
 #if defined(LJH_TARGET_Windows_UWP)
 #    define WIN32_LEAN_AND_MEAN
@@ -32,7 +34,16 @@
 #    include <sys/types.h>
 #    include <sys/stat.h>
 #    include <pwd.h>
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstring>
 #    include <fstream>
+#    include <iterator>
+#    include <string_view>
+#    include <thread>
+#    if defined(LJH_TARGET_Linux)
+#    include <sys/inotify.h>
+#    endif
 #elif defined(LJH_TARGET_MacOS)
 #    include <pwd.h>
 #    include <unistd.h>
@@ -61,7 +72,7 @@ namespace ljh
 			}
 		};
 
-		[[nodiscard]] com_deinit init_com()
+		[[nodiscard]] static com_deinit init_com()
 		{
 			UINT64 data;
 			auto status = RoGetApartmentIdentifier(&data);
@@ -70,69 +81,69 @@ namespace ljh
 			return com_deinit{false};
 		}
 
-		std::string home()
+		static std::string _home()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Profile());
 		}
 
-		std::string cache()
+		static std::string _cache()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().LocalAppData());
 		}
 
-		std::string config()
+		static std::string _config()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().RoamingAppData());
 		}
 
-		std::string data()
+		static std::string _data()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().RoamingAppData());
 		}
 
-		std::string documents()
+		static std::string _documents()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Documents());
 		}
 
-		std::string desktop()
+		static std::string _desktop()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Desktop());
 		}
 
-		std::string pictures()
+		static std::string _pictures()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Pictures());
 		}
 
-		std::string music()
+		static std::string _music()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Music());
 		}
 
-		std::string videos()
+		static std::string _videos()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Videos());
 		}
 
-		std::string downloads()
+		static std::string _downloads()
 		{
 			auto com = init_com();
 			return winrt::to_string(winrt::Windows::Storage::UserDataPaths::GetDefault().Downloads());
 		}
 
-		std::string save_games()
+		static std::string _save_games()
 		{
-			return documents() + "My Games\\";
+			return _documents() + "My Games\\";
 		}
 
 
@@ -158,7 +169,7 @@ namespace ljh
 			return output;
 		}
 
-		std::string _get_windows_dir(REFKNOWNFOLDERID folder_id, int folder_csidl)
+		static std::string _get_windows_dir(REFKNOWNFOLDERID folder_id, int folder_csidl)
 		{
 			using SHGetKnownFolderPath_FNP = HRESULT(__stdcall*)(REFKNOWNFOLDERID,DWORD,HANDLE,PWSTR*);
 			static auto _SHGetKnownFolderPath = (SHGetKnownFolderPath_FNP)GetProcAddress(LoadLibrary(TEXT("Shell32.dll")), "SHGetKnownFolderPath");
@@ -181,420 +192,456 @@ namespace ljh
 			return "";
 		}
 
-		std::string home()
+		static std::string _home()
 		{
 			return _get_windows_dir(FOLDERID_Profile, CSIDL_PROFILE);
 		}
 
-		std::string cache()
+		static std::string _cache()
 		{
 			return _get_windows_dir(FOLDERID_LocalAppData, CSIDL_LOCAL_APPDATA);
 		}
 
-		std::string config()
+		static std::string _config()
 		{
 			return _get_windows_dir(FOLDERID_RoamingAppData, CSIDL_APPDATA);
 		}
 
-		std::string data()
+		static std::string _data()
 		{
 			return _get_windows_dir(FOLDERID_RoamingAppData, CSIDL_APPDATA);
 		}
 
-		std::string documents()
+		static std::string _documents()
 		{
 			return _get_windows_dir(FOLDERID_Documents, CSIDL_PERSONAL);
 		}
 
-		std::string desktop()
+		static std::string _desktop()
 		{
 			return _get_windows_dir(FOLDERID_Desktop, CSIDL_DESKTOPDIRECTORY);
 		}
 
-		std::string pictures()
+		static std::string _pictures()
 		{
 			return _get_windows_dir(FOLDERID_Pictures, CSIDL_MYPICTURES);
 		}
 
-		std::string music()
+		static std::string _music()
 		{
 			return _get_windows_dir(FOLDERID_Music, CSIDL_MYMUSIC);
 		}
 
-		std::string videos()
+		static std::string _videos()
 		{
 			return _get_windows_dir(FOLDERID_Videos, CSIDL_MYVIDEO);
 		}
 
-		std::string downloads()
+		static std::string _downloads()
 		{
 			auto value = _get_windows_dir(FOLDERID_Downloads, CSIDL_FLAG_MASK);
 			if (value.empty())
 			{
-				return home() + "Downloads\\";
+				return _home() + "Downloads\\";
 			}
 			return value;
 		}
 
-		std::string save_games()
+		static std::string _save_games()
 		{
 			auto value = _get_windows_dir(FOLDERID_SavedGames, CSIDL_FLAG_MASK);
 			if (value.empty())
 			{
-				return documents() + "My Games\\";
+				return _documents() + "My Games\\";
 			}
 			return value;
 		}
 #elif defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Unix)
-		bool _directory_exists(std::string& path)
+		// Relative paths are ignored, as the XDG base directory spec asks
+		static std::string _absolute_directory(std::string path)
 		{
-			struct stat file_stats;
-			if (stat(path.c_str(), &file_stats) || !S_ISDIR(file_stats.st_mode))
+			if (path.empty() || path[0] != '/')
+			{
+				return "";
+			}
+			if (path[path.size() - 1] != '/')
 			{
-				return false;
+				path += '/';
 			}
-			return true;
+			return path;
 		}
 
-		std::string _read_xdg_user_dir_config(std::string item)
+		static std::string _environment_directory(char const* name)
 		{
-			std::string filename = config() + "user-dirs.dirs";
-			std::ifstream file(filename.c_str());
-			if (file.is_open())
-			{
-				for (std::string line; std::getline(file, line);)
-				{
-					if (line.find(item) != 0)
-					{
-						continue;
-					}
-					std::size_t opening = line.find('"') + 1;
-					line = line.substr(opening,line.size()-opening-1);
-					if (line.find("$HOME") != 0)
-					{
-						line = home() + line.substr(5);
-					}
-					if (line[0] != '/')
-					{
-						break;
-					}
-					return line;
-				}
-			}
-			return "";
+			char const* value = getenv(name);
+			return value != NULL ? _absolute_directory(value) : "";
 		}
 
-		std::string home()
+		static std::string _home()
 		{
-			std::string dir = getenv("HOME");
-			if (getuid() != 0 && !dir.empty())
+			if (getuid() != 0)
 			{
-				return dir;
+				std::string dir = _environment_directory("HOME");
+				if (!dir.empty())
+				{
+					return dir;
+				}
 			}
 			passwd* pw = getpwuid(getuid());
 			if (!pw)
 			{
 				return "";
 			}
-			return pw->pw_dir;
+			return _absolute_directory(pw->pw_dir);
 		}
 
-		std::string cache()
+		static std::string _base_directory(char const* variable, std::string const& home, char const* fallback)
 		{
-			const char* dir_config = getenv("XDG_CACHE_HOME");
-			if (dir_config != NULL)
+			std::string dir = _environment_directory(variable);
+			if (dir.empty() && !home.empty())
 			{
-				return dir_config;
-			}
-			std::string dir = home();
-			if (!dir.empty())
-			{
-				dir += ".cache/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
+				dir = home + fallback;
 			}
-			return "";
+			return dir;
 		}
 
-		std::string config()
+		struct _user_dir
 		{
-			const char* dir_config = getenv("XDG_CONFIG_HOME");
-			if (dir_config != NULL)
+			char const*                   key;
+			char const*                   fallback;
+			std::string directory_table::*member;
+		};
+
+		static _user_dir const _user_dirs[] = {
+			{"XDG_DOCUMENTS_DIR", "Documents/", &directory_table::documents},
+			{"XDG_DESKTOP_DIR",   "Desktop/",   &directory_table::desktop  },
+			{"XDG_PICTURES_DIR",  "Pictures/",  &directory_table::pictures },
+			{"XDG_MUSIC_DIR",     "Music/",     &directory_table::music    },
+			{"XDG_VIDEOS_DIR",    "Videos/",    &directory_table::videos   },
+			{"XDG_DOWNLOAD_DIR",  "Downloads/", &directory_table::downloads},
+		};
+
+		// Reads every entry of user-dirs.dirs in one pass, lines look like XDG_DESKTOP_DIR="$HOME/Desktop"
+		static void _read_xdg_user_dirs(directory_table& table)
+		{
+			if (table.config.empty())
 			{
-				return dir_config;
+				return;
 			}
-			std::string dir = home();
-			if (!dir.empty())
+			std::ifstream file((table.config + "user-dirs.dirs").c_str());
+			for (std::string line; std::getline(file, line);)
 			{
-				dir += ".config/";
-				if (!_directory_exists(dir))
+				std::size_t equals = line.find('=');
+				if (equals == std::string::npos)
 				{
-					return dir;
+					continue;
+				}
+				std::string_view key{line.data(), equals};
+				_user_dir const* entry = std::find_if(std::begin(_user_dirs), std::end(_user_dirs), [&](_user_dir const& dir) { return key == dir.key; });
+				std::size_t opening = line.find('"', equals);
+				std::size_t closing = line.rfind('"');
+				if (entry == std::end(_user_dirs) || opening == std::string::npos || closing <= opening)
+				{
+					continue;
 				}
-			}
-			return "";
-		}
 
-		std::string data()
-		{
-			const char* dir_config = getenv("XDG_DATA_HOME");
-			if (dir_config != NULL)
-			{
-				return dir_config;
-			}
-			std::string dir = home();
-			if (!dir.empty())
-			{
-				dir += ".local/share/";
-				if (!_directory_exists(dir))
+				std::string value = line.substr(opening + 1, closing - opening - 1);
+				if (value.compare(0, 5, "$HOME") == 0)
 				{
-					return dir;
+					if (table.home.empty())
+					{
+						continue;
+					}
+					value = table.home + value.substr(value.compare(0, 6, "$HOME/") == 0 ? 6 : 5);
+				}
+				value = _absolute_directory(value);
+				if (!value.empty())
+				{
+					table.*entry->member = value;
 				}
 			}
-			return "";
 		}
 
-		std::string documents()
+		static directory_table* _build_table()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_DOCUMENTS_DIR");
-			if (!dir.empty())
+			directory_table* table = new directory_table;
+			table->home            = _home();
+			table->cache           = _base_directory("XDG_CACHE_HOME", table->home, ".cache/");
+			table->config          = _base_directory("XDG_CONFIG_HOME", table->home, ".config/");
+			table->data            = _base_directory("XDG_DATA_HOME", table->home, ".local/share/");
+			if (!table->home.empty())
 			{
-				return dir;
-			}
-			dir = home();
-			if (!dir.empty())
-			{
-				dir += "Documents/";
-				if (!_directory_exists(dir))
+				for (_user_dir const& dir : _user_dirs)
 				{
-					return dir;
+					table->*dir.member = table->home + dir.fallback;
 				}
 			}
-			return "";
+			_read_xdg_user_dirs(*table);
+			table->save_games = table->data;
+			return table;
 		}
 
-		std::string desktop()
+#elif defined(LJH_TARGET_MacOS)
+		static std::string _home()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_DESKTOP_DIR");
-			if (!dir.empty())
+			std::string dir = getenv("HOME");
+			if (getuid() != 0 && !dir.empty())
 			{
 				return dir;
 			}
-			dir = home();
-			if (!dir.empty())
+			passwd* pw = getpwuid(getuid());
+			if (!pw)
 			{
-				dir += "Desktop/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
+				return "";
 			}
-			return "";
+			return pw->pw_dir;
 		}
 
-		std::string pictures()
+		static std::string _cache()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_PICTURES_DIR");
-			if (!dir.empty())
-			{
-				return dir;
-			}
-			dir = home();
-			if (!dir.empty())
-			{
-				dir += "Pictures/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
-			}
-			return "";
+			return _home() + "/Library/Caches";
 		}
 
-		std::string music()
+		static std::string _config()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_MUSIC_DIR");
-			if (!dir.empty())
-			{
-				return dir;
-			}
-			dir = home();
-			if (!dir.empty())
-			{
-				dir += "Music/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
-			}
-			return "";
+			return _home() + "/Library/Application Support";
 		}
 
-		std::string videos()
+		static std::string _data()
+		{
+			return _home() + "/Library/Application Support";
+		}
+
+		static std::string _documents()
+		{
+			return _home() + "/Desktop";
+		}
+
+		static std::string _desktop()
+		{
+			return _home() + "/Desktop";
+		}
+
+		static std::string _pictures()
+		{
+			return _home() + "/Pictures";
+		}
+
+		static std::string _music()
+		{
+			return _home() + "/Music";
+		}
+
+		static std::string _videos()
+		{
+			return _home() + "/Movies";
+		}
+
+		static std::string _downloads()
+		{
+			return _home() + "/Library/Caches";
+		}
+
+		static std::string _save_games()
+		{
+			return _home() + "/Library/Application Support";
+		}
+#else
+		static std::string _home()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_VIDEOS_DIR");
-			if (!dir.empty())
-			{
-				return dir;
-			}
-			dir = home();
-			if (!dir.empty())
-			{
-				dir += "Videos/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
-			}
 			return "";
 		}
 
-		std::string downloads()
+		static std::string _cache()
 		{
-			std::string dir = _read_xdg_user_dir_config("XDG_DOWNLOAD_DIR");
-			if (!dir.empty())
-			{
-				return dir;
-			}
-			dir = home();
-			if (!dir.empty())
-			{
-				dir += "Downloads/";
-				if (!_directory_exists(dir))
-				{
-					return dir;
-				}
-			}
 			return "";
 		}
 
-		std::string save_games()
+		static std::string _config()
 		{
-			return data();
+			return "";
 		}
 
-#elif defined(LJH_TARGET_MacOS)
-		std::string home()
+		static std::string _data()
 		{
-			std::string dir = getenv("HOME");
-			if (getuid() != 0 && !dir.empty())
-			{
-				return dir;
-			}
-			passwd* pw = getpwuid(getuid());
-			if (!pw)
-			{
-				return "";
-			}
-			return pw->pw_dir;
+			return "";
 		}
 
-		std::string cache()
+		static std::string _documents()
 		{
-			return home() + "/Library/Caches";
+			return "";
 		}
 
-		std::string config()
+		static std::string _desktop()
 		{
-			return home() + "/Library/Application Support";
+			return "";
 		}
 
-		std::string data()
+		static std::string _pictures()
 		{
-			return home() + "/Library/Application Support";
+			return "";
 		}
 
-		std::string documents()
+		static std::string _music()
 		{
-			return home() + "/Desktop";
+			return "";
 		}
 
-		std::string desktop()
+		static std::string _videos()
 		{
-			return home() + "/Desktop";
+			return "";
 		}
 
-		std::string pictures()
+		static std::string _downloads()
 		{
-			return home() + "/Pictures";
+			return "";
 		}
 
-		std::string music()
+		static std::string _save_games()
 		{
-			return home() + "/Music";
+			return "";
 		}
+#endif
 
-		std::string videos()
+#if !defined(LJH_TARGET_Linux) && !defined(LJH_TARGET_Unix)
+		static directory_table* _build_table()
 		{
-			return home() + "/Movies";
+			return new directory_table{_home(), _cache(), _config(), _data(), _documents(), _desktop(), _pictures(), _music(), _videos(), _downloads(), _save_games()};
 		}
+#endif
 
-		std::string downloads()
+		// Replaced tables are never freed so references handed out earlier stay valid.
+		static std::atomic<directory_table const*> _current_table{nullptr};
+		static std::mutex                          _table_mutex;
+
+		directory_table const& cached()
 		{
-			return home() + "/Library/Caches";
+			if (auto table = _current_table.load(std::memory_order_acquire))
+			{
+				return *table;
+			}
+
+			std::scoped_lock lock{_table_mutex};
+			if (auto table = _current_table.load(std::memory_order_acquire))
+			{
+				return *table;
+			}
+
+			auto table = _build_table();
+			_current_table.store(table, std::memory_order_release);
+			return *table;
 		}
 
-		std::string save_games()
+		void invalidate()
 		{
-			return home() + "/Library/Application Support";
+			std::scoped_lock lock{_table_mutex};
+			_current_table.store(nullptr, std::memory_order_release);
 		}
+
+		bool watch_for_changes()
+		{
+#if defined(LJH_TARGET_Linux)
+			static bool const watching = []
+			{
+				std::string config = cached().config;
+				int fd = inotify_init1(IN_CLOEXEC);
+				if (config.empty() || fd < 0)
+				{
+					return false;
+				}
+				if (inotify_add_watch(fd, config.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE) < 0)
+				{
+					close(fd);
+					return false;
+				}
+
+				std::thread([fd]
+				{
+					alignas(inotify_event) char buffer[4096];
+					for (;;)
+					{
+						ssize_t size = read(fd, buffer, sizeof(buffer));
+						if (size < 0 && errno == EINTR)
+						{
+							continue;
+						}
+						if (size <= 0)
+						{
+							break;
+						}
+						for (char* at = buffer; at < buffer + size;)
+						{
+							auto event = reinterpret_cast<inotify_event*>(at);
+							if (event->len != 0 && std::strcmp(event->name, "user-dirs.dirs") == 0)
+							{
+								invalidate();
+							}
+							at += sizeof(inotify_event) + event->len;
+						}
+					}
+					close(fd);
+				}).detach();
+				return true;
+			}();
+			return watching;
 #else
+			return false;
+#endif
+		}
+
 		std::string home()
 		{
-			return "";
+			return cached().home;
 		}
 
 		std::string cache()
 		{
-			return "";
+			return cached().cache;
 		}
 
 		std::string config()
 		{
-			return "";
+			return cached().config;
 		}
 
 		std::string data()
 		{
-			return "";
+			return cached().data;
 		}
 
 		std::string documents()
 		{
-			return "";
+			return cached().documents;
 		}
 
 		std::string desktop()
 		{
-			return "";
+			return cached().desktop;
 		}
 
 		std::string pictures()
 		{
-			return "";
+			return cached().pictures;
 		}
 
 		std::string music()
 		{
-			return "";
+			return cached().music;
 		}
 
 		std::string videos()
 		{
-			return "";
+			return cached().videos;
 		}
 
 		std::string downloads()
 		{
-			return "";
+			return cached().downloads;
 		}
 
 		std::string save_games()
 		{
-			return "";
+			return cached().save_games;
 		}
-#endif
 	}
-}
\ No newline at end of file
+}
\ No newline at end of file
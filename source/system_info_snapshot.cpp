@@ -0,0 +1,43 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/system_info.hpp"
+#include <atomic>
+#include <mutex>
+
+namespace
+{
+	// Replaced snapshots are never freed so references handed out earlier stay valid.
+	std::atomic<ljh::system_info::snapshot_data const*> current{nullptr};
+	std::mutex                                          probe_mutex;
+
+	ljh::system_info::snapshot_data const* probe()
+	{
+		using namespace ljh::system_info;
+		return new snapshot_data{get_platform(), get_version(), get_string(), get_sdk(), get_model(), get_manufacturer(), get_hardware()};
+	}
+}
+
+ljh::system_info::snapshot_data const& ljh::system_info::snapshot()
+{
+	if (auto data = current.load(std::memory_order_acquire))
+		return *data;
+
+	std::scoped_lock lock{probe_mutex};
+	if (auto data = current.load(std::memory_order_acquire))
+		return *data;
+
+	auto data = probe();
+	current.store(data, std::memory_order_release);
+	return *data;
+}
+
+ljh::system_info::snapshot_data const& ljh::system_info::refresh()
+{
+	std::scoped_lock lock{probe_mutex};
+	auto data = probe();
+	current.store(data, std::memory_order_release);
+	return *data;
+}
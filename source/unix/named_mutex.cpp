@@ -1,40 +1,283 @@
-
 //          Copyright Jared Irwin 2020-2026
 // Distributed under the Boost Software License, Version 1.0.
 //    (See accompanying file LICENSE_1_0.txt or copy at
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "ljh/named_mutex.hpp"
+#include "ljh/os_build_info.hpp"
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <ctime>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(LJH_TARGET_Linux)
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#else
+#include <algorithm>
 #include <semaphore.h>
-#include <string>
+#include <thread>
+#endif
+
+#ifndef NAME_MAX
+#define NAME_MAX 255
+#endif
+
+static constexpr mode_t everyone_read_write = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+
+// Object names have to start with a slash
+static void object_name(char (&path)[NAME_MAX + 1], char const* name)
+{
+	std::snprintf(path, sizeof(path), "/%s", name);
+}
+
+#if defined(LJH_TARGET_Linux)
+namespace
+{
+	enum : std::uint32_t
+	{
+		uninitialized,
+		// Attempt n at setting up the mutex is `initializing + n`, every takeover counts up from here
+		initializing,
+		// Or'd with the attempt that finished
+		ready = 0x8000'0000,
+	};
+
+	constexpr std::uint32_t attempts = 4;
+
+	// Shared memory starts zeroed, so the first process to see `uninitialized` sets up the mutex.
+	// glibc's robust process shared mutex is used for the lock itself: it takes the lock with a
+	// compare exchange on a futex word, only calls into the kernel when there are waiters and
+	// is on the kernel's robust list so it can be recovered when its owner dies.
+	struct shared_mutex
+	{
+		std::atomic<std::uint32_t> state;
+		// Every attempt sets up its own mutex, so one that stalls and carries on after it was taken
+		// over from only ever writes to a mutex nobody uses.
+		pthread_mutex_t mutexes[attempts];
+	};
+	static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+
+	// Setting the mutex up is a handful of stores, a process that hasn't finished by now most
+	// likely died half way through and would leave everyone else waiting forever.
+	constexpr timespec takeover_timeout{1, 0};
+
+	void set_up(shared_mutex* shared, std::uint32_t attempt)
+	{
+		pthread_mutexattr_t attributes;
+		pthread_mutexattr_init(&attributes);
+		pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+		pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+		pthread_mutex_init(&shared->mutexes[attempt - initializing], &attributes);
+		pthread_mutexattr_destroy(&attributes);
+
+		// If another process took over in the meantime it finishes instead
+		if (shared->state.compare_exchange_strong(attempt, ready | (attempt - initializing), std::memory_order_release, std::memory_order_relaxed))
+			syscall(SYS_futex, &shared->state, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+	}
+
+	// False when every attempt was taken over from without finishing.
+	bool initialize(shared_mutex* shared)
+	{
+		std::uint32_t state = uninitialized;
+		if (shared->state.compare_exchange_strong(state, initializing, std::memory_order_acquire))
+			set_up(shared, initializing);
+
+		// Only one waiter can move the state on from the attempt that timed out, so only one takes over
+		while (((state = shared->state.load(std::memory_order_acquire)) & ready) == 0)
+		{
+			if (syscall(SYS_futex, &shared->state, FUTEX_WAIT, state, &takeover_timeout, nullptr, 0) == 0 || errno != ETIMEDOUT)
+				continue;
+			if (state == initializing + attempts - 1)
+				return false;
+			if (shared->state.compare_exchange_strong(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed))
+				set_up(shared, state + 1);
+		}
+		return true;
+	}
+
+	pthread_mutex_t* mutex_of(void* object)
+	{
+		if (!object)
+			return nullptr;
+		auto shared = static_cast<shared_mutex*>(object);
+		return &shared->mutexes[shared->state.load(std::memory_order_relaxed) & ~ready];
+	}
+
+	timespec deadline_after(clockid_t clock, std::int64_t nanoseconds)
+	{
+		timespec deadline;
+		clock_gettime(clock, &deadline);
+		std::int64_t nsec = deadline.tv_nsec + nanoseconds % 1'000'000'000;
+		deadline.tv_sec  += nanoseconds / 1'000'000'000 + nsec / 1'000'000'000;
+		deadline.tv_nsec  = nsec % 1'000'000'000;
+		return deadline;
+	}
+
+	// The previous owner died while holding the lock, we own it now.
+	bool acquired(pthread_mutex_t* mutex, int result)
+	{
+		if (result == EOWNERDEAD)
+		{
+			pthread_mutex_consistent(mutex);
+			return true;
+		}
+		return result == 0;
+	}
+}
+
+namespace ljh::__
+{
+	void* create_mutex(char const* name)
+	{
+		char path[NAME_MAX + 1];
+		object_name(path, name);
+
+		int fd = shm_open(path, O_RDWR | O_CREAT | O_CLOEXEC, everyone_read_write);
+		if (fd == -1)
+			return nullptr;
+
+		void* memory = MAP_FAILED;
+		if (ftruncate(fd, sizeof(shared_mutex)) == 0)
+			memory = mmap(nullptr, sizeof(shared_mutex), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+		if (memory == MAP_FAILED)
+			return nullptr;
+
+		auto shared = static_cast<shared_mutex*>(memory);
+		if (!initialize(shared))
+		{
+			munmap(memory, sizeof(shared_mutex));
+			return nullptr;
+		}
+		return shared;
+	}
+
+	void release_mutex(void* object)
+	{
+		if (object)
+			munmap(object, sizeof(shared_mutex));
+	}
+
+	void lock_mutex(void* object)
+	{
+		if (auto mutex = mutex_of(object))
+			acquired(mutex, pthread_mutex_lock(mutex));
+	}
+
+	bool try_lock_mutex(void* object)
+	{
+		auto mutex = mutex_of(object);
+		return mutex && acquired(mutex, pthread_mutex_trylock(mutex));
+	}
+
+	bool try_lock_mutex_for(void* object, std::int64_t nanoseconds)
+	{
+		auto mutex = mutex_of(object);
+		if (!mutex)
+			return false;
+
+		// pthread_mutex_clocklock is new in glibc 2.30, before that there are only CLOCK_REALTIME deadlines
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 30))
+		timespec deadline = deadline_after(CLOCK_MONOTONIC, nanoseconds);
+		return acquired(mutex, pthread_mutex_clocklock(mutex, CLOCK_MONOTONIC, &deadline));
+#else
+		timespec deadline = deadline_after(CLOCK_REALTIME, nanoseconds);
+		return acquired(mutex, pthread_mutex_timedlock(mutex, &deadline));
+#endif
+	}
+
+	// Robust mutexes check ownership, unlocking one this thread doesn't hold does nothing.
+	void unlock_mutex(void* object)
+	{
+		if (auto mutex = mutex_of(object))
+			pthread_mutex_unlock(mutex);
+	}
+}
+#else
+namespace
+{
+	// Semaphores have no owner, so track whether this object holds it to keep
+	// unlocking an unlocked mutex from raising the count above one.
+	struct semaphore_mutex
+	{
+		sem_t*            semaphore;
+		std::atomic<bool> held{false};
+	};
+
+	bool acquired(semaphore_mutex* mutex, bool result)
+	{
+		if (result)
+			mutex->held.store(true, std::memory_order_relaxed);
+		return result;
+	}
+}
 
 namespace ljh::__
 {
 	void* create_mutex(char const* name)
 	{
-		using namespace std::string_literals;
-		return sem_open(("/"s + name).data(), O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH, 1);
+		char path[NAME_MAX + 1];
+		object_name(path, name);
+
+		sem_t* semaphore = sem_open(path, O_CREAT, everyone_read_write, 1);
+		if (semaphore == SEM_FAILED)
+			return nullptr;
+		return new semaphore_mutex{semaphore};
 	}
 
 	void release_mutex(void* object)
 	{
-		sem_close((sem_t*)object);
+		if (auto mutex = static_cast<semaphore_mutex*>(object))
+		{
+			sem_close(mutex->semaphore);
+			delete mutex;
+		}
 	}
 
 	void lock_mutex(void* object)
 	{
-		sem_wait((sem_t*)object);
+		if (auto mutex = static_cast<semaphore_mutex*>(object))
+		{
+			while (sem_wait(mutex->semaphore) == -1 && errno == EINTR)
+				;
+			acquired(mutex, true);
+		}
 	}
 
 	bool try_lock_mutex(void* object)
 	{
-		return sem_trywait((sem_t*)object) == -1;
+		auto mutex = static_cast<semaphore_mutex*>(object);
+		return mutex && acquired(mutex, sem_trywait(mutex->semaphore) == 0);
+	}
+
+	// Not every platform has sem_timedwait, poll with a growing backoff instead.
+	bool try_lock_mutex_for(void* object, std::int64_t nanoseconds)
+	{
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds{nanoseconds};
+		auto backoff  = std::chrono::microseconds{50};
+		while (!try_lock_mutex(object))
+		{
+			auto now = std::chrono::steady_clock::now();
+			if (!object || now >= deadline)
+				return false;
+			std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(backoff, deadline - now));
+			backoff = std::min(backoff * 2, std::chrono::microseconds{5000});
+		}
+		return true;
 	}
 
 	void unlock_mutex(void* object)
 	{
-		sem_post((sem_t*)object);
+		auto mutex = static_cast<semaphore_mutex*>(object);
+		if (mutex && mutex->held.exchange(false, std::memory_order_relaxed))
+			sem_post(mutex->semaphore);
 	}
-}
\ No newline at end of file
+}
+#endif
@@ -12,7 +12,12 @@
 
 #if defined(LJH_TARGET_Linux) || defined(LJH_TARGET_Unix)
 #include <sys/utsname.h>
+#include <unistd.h>
 #include <fstream>
+#include <algorithm>
+#include <set>
+#include <string_view>
+#include <utility>
 #endif
 
 #if defined(LJH_TARGET_Linux)
@@ -84,6 +89,132 @@ ljh::expected<std::string, ljh::system_info::error> ljh::system_info::get_manufa
 }
 #endif
 
+#if defined(LJH_TARGET_Linux)
+static std::string read_line(std::string const& path)
+{
+	std::ifstream file{path};
+	std::string line;
+	std::getline(file, line);
+	return line;
+}
+
+static ljh::u64 read_number(std::string_view text)
+{
+	ljh::u64 value = 0;
+	for (char c : text)
+	{
+		if (c < '0' || c > '9')
+			break;
+		value = value * 10 + (c - '0');
+	}
+	return value;
+}
+
+// Parses the kernel's cpu list format, "0-3,8,10-11"
+static std::vector<ljh::u32> read_cpu_list(std::string const& path)
+{
+	std::vector<ljh::u32> ids;
+	std::string list = read_line(path);
+	std::string_view rest = list;
+	while (!rest.empty())
+	{
+		auto comma = rest.find(',');
+		auto item  = rest.substr(0, comma);
+		auto dash  = item.find('-');
+		auto first = read_number(item);
+		auto last  = dash == std::string_view::npos ? first : read_number(item.substr(dash + 1));
+		for (auto id = first; id <= last; id++)
+			ids.push_back(ljh::u32(id));
+		rest = comma == std::string_view::npos ? std::string_view{} : rest.substr(comma + 1);
+	}
+	return ids;
+}
+
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	hardware_info info;
+	info.page_size = u64(sysconf(_SC_PAGESIZE));
+
+	auto cpus = read_cpu_list("/sys/devices/system/cpu/online");
+	info.logical_cores = cpus.empty() ? u32(sysconf(_SC_NPROCESSORS_ONLN)) : u32(cpus.size());
+
+	std::set<std::pair<u64, u64>> cores;
+	std::set<u64> packages;
+	for (auto cpu : cpus)
+	{
+		auto topology = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+		auto package  = read_line(topology + "physical_package_id");
+		auto core     = read_line(topology + "core_id");
+		if (package.empty() || core.empty())
+			continue;
+		packages.insert(read_number(package));
+		cores.emplace(read_number(package), read_number(core));
+	}
+	info.physical_cores = u32(cores.size());
+	info.packages       = u32(packages.size());
+
+	auto nodes = read_cpu_list("/sys/devices/system/node/online");
+	info.numa_nodes = nodes.empty() ? 1 : u32(nodes.size());
+
+	if (!cpus.empty())
+	{
+		auto cache_path = "/sys/devices/system/cpu/cpu" + std::to_string(cpus.front()) + "/cache/index";
+		for (int index = 0;; index++)
+		{
+			auto path  = cache_path + std::to_string(index) + '/';
+			auto level = read_line(path + "level");
+			if (level.empty())
+				break;
+
+			cache_info cache;
+			cache.level     = u08(read_number(level));
+			cache.line_size = u32(read_number(read_line(path + "coherency_line_size")));
+
+			auto size = read_line(path + "size");
+			cache.size = read_number(size);
+			if (size.find('K') != std::string::npos) cache.size *= 1024;
+			if (size.find('M') != std::string::npos) cache.size *= 1024 * 1024;
+
+			auto type = read_line(path + "type");
+			if (type == "Data")        cache.type = cache_type::data;
+			if (type == "Instruction") cache.type = cache_type::instruction;
+
+			info.caches.push_back(cache);
+		}
+		std::stable_sort(info.caches.begin(), info.caches.end(), [](cache_info const& a, cache_info const& b) { return a.level < b.level; });
+	}
+
+	std::ifstream meminfo{"/proc/meminfo"};
+	std::string line;
+	while (std::getline(meminfo, line))
+	{
+		std::string_view view = line;
+		auto value = view.substr(view.find(':') + 1);
+		value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+		if (view.starts_with("Hugepagesize:"))
+			info.huge_page_size = read_number(value) * 1024;
+		if (view.starts_with("HugePages_Total:") && read_number(value) != 0)
+			info.huge_pages = true;
+	}
+
+	auto transparent = read_line("/sys/kernel/mm/transparent_hugepage/enabled");
+	if (!transparent.empty() && transparent.find("[never]") == std::string::npos)
+		info.huge_pages = true;
+	if (info.huge_page_size == 0)
+		info.huge_pages = false;
+
+	return info;
+}
+#elif defined(LJH_TARGET_Unix)
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	hardware_info info;
+	info.page_size     = u64(sysconf(_SC_PAGESIZE));
+	info.logical_cores = u32(sysconf(_SC_NPROCESSORS_ONLN));
+	return info;
+}
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
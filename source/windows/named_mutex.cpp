@@ -24,13 +24,23 @@ namespace ljh::__
 		WaitForSingleObject(object, INFINITE);
 	}
 
+	// An abandoned mutex is owned by the thread that waited on it
 	bool try_lock_mutex(void* object)
 	{
-		return WaitForSingleObject(object, 0) == WAIT_OBJECT_0;
+		auto result = WaitForSingleObject(object, 0);
+		return result == WAIT_OBJECT_0 || result == WAIT_ABANDONED;
+	}
+
+	bool try_lock_mutex_for(void* object, std::int64_t nanoseconds)
+	{
+		// Round up so short timeouts still wait
+		auto milliseconds = (nanoseconds + 999'999) / 1'000'000;
+		auto result       = WaitForSingleObject(object, milliseconds >= INFINITE ? INFINITE - 1 : DWORD(milliseconds));
+		return result == WAIT_OBJECT_0 || result == WAIT_ABANDONED;
 	}
 
 	void unlock_mutex(void* object)
 	{
 		ReleaseMutex(object);
 	}
-}
\ No newline at end of file
+}
\ No newline at end of file
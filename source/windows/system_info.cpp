@@ -22,6 +22,8 @@
 #include "ljh/windows/registry.hpp"
 #include <windows.h>
 #include <winternl.h>
+#include <algorithm>
+#include <vector>
 #if defined(LJH_TARGET_Windows_UWP)
 using NTSTATUS = unsigned int;
 #endif
@@ -260,6 +262,60 @@ static void system_alerts()
 	}
 }
 
+ljh::expected<ljh::system_info::hardware_info, ljh::system_info::error> ljh::system_info::get_hardware()
+{
+	hardware_info info;
+
+	SYSTEM_INFO system = {};
+	GetNativeSystemInfo(&system);
+	info.page_size     = system.dwPageSize;
+	info.logical_cores = system.dwNumberOfProcessors;
+#if !defined(LJH_TARGET_Windows_UWP)
+	info.huge_page_size = GetLargePageMinimum();
+#endif
+	info.huge_pages = info.huge_page_size != 0;
+
+	DWORD length = 0;
+	GetLogicalProcessorInformation(nullptr, &length);
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	if (buffer.empty() || !GetLogicalProcessorInformation(buffer.data(), &length))
+		return info;
+
+	for (auto& item : buffer)
+	{
+		switch (item.Relationship)
+		{
+		case RelationProcessorCore:
+			info.physical_cores++;
+			break;
+		case RelationProcessorPackage:
+			info.packages++;
+			break;
+		case RelationNumaNode:
+			info.numa_nodes++;
+			break;
+		case RelationCache:
+		{
+			// Only the caches the first core uses
+			if ((item.ProcessorMask & 1) == 0)
+				break;
+			cache_info cache;
+			cache.level     = u08(item.Cache.Level);
+			cache.size      = item.Cache.Size;
+			cache.line_size = item.Cache.LineSize;
+			cache.type      = item.Cache.Type == CacheData ? cache_type::data : item.Cache.Type == CacheInstruction ? cache_type::instruction : cache_type::unified;
+			info.caches.push_back(cache);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	std::stable_sort(info.caches.begin(), info.caches.end(), [](cache_info const& a, cache_info const& b) { return a.level < b.level; });
+
+	return info;
+}
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma GCC diagnostic pop
 #elif defined(_MSC_VER)
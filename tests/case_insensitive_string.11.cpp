@@ -0,0 +1,66 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/case_insensitive_string.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <unordered_map>
+
+TEST_CASE("case_insensitive_string compare", "[test_11][case_insensitive_string]")
+{
+    REQUIRE(ljh::case_insensitive_string{"Content-Type"} == "content-type");
+    REQUIRE(ljh::case_insensitive_string{"X-A-Very-Long-Header-Name"} == "x-a-very-long-header-name");
+    REQUIRE(ljh::case_insensitive_string{"X-A-Very-Long-Header-Name"} != "x-a-very-long-header-namf");
+    REQUIRE(ljh::case_insensitive_string{"abcdefghz"} < "ABCDEFGH_");
+    REQUIRE(ljh::case_insensitive_string{"ABCDEFGHA"} < "abcdefghb");
+    REQUIRE(ljh::case_insensitive_string{"abcdefgh@"}.compare("ABCDEFGH`") < 0);
+    REQUIRE(ljh::case_insensitive_string{"[]^"} != "{}~");
+}
+
+TEST_CASE("case_insensitive_string unicode", "[test_11][case_insensitive_string]")
+{
+    REQUIRE(ljh::u16case_insensitive_string{u"ÉTÉ"} == u"été");
+    REQUIRE(ljh::u16case_insensitive_string{u"ПРИВЕТ"} == u"привет");
+    REQUIRE(ljh::u16case_insensitive_string{u"ΟΔΟΣ"} == u"οδος");
+    REQUIRE(ljh::u16case_insensitive_string{u"Ά"} == u"ά");
+    REQUIRE(ljh::u32case_insensitive_string{U"K"} == U"k");
+    REQUIRE(ljh::u32case_insensitive_string{U"İ"} != U"i");
+    REQUIRE(ljh::u32case_insensitive_string{U"\U00010400"} == U"\U00010428");
+    REQUIRE(ljh::u32case_insensitive_string{U"ā"} != U"Ă");
+    REQUIRE(ljh::u32case_insensitive_string{U"Ă"} == U"ă");
+}
+
+TEST_CASE("case_insensitive_string find", "[test_11][case_insensitive_string]")
+{
+    ljh::case_insensitive_string text{"the quick brown fox jumps over the lazy dog"};
+    REQUIRE(text.find('Q') == 4);
+    REQUIRE(text.find('D') == 40);
+    REQUIRE(text.find("LAZY") == 35);
+    REQUIRE(text.find('!') == ljh::case_insensitive_string::npos);
+
+    ljh::u16case_insensitive_string wide{u"abcé"};
+    REQUIRE(wide.find(u'É') == 3);
+}
+
+TEST_CASE("case_insensitive_string hash", "[test_11][case_insensitive_string]")
+{
+    std::hash<ljh::case_insensitive_string> hash;
+    REQUIRE(hash("Content-Type") == hash("CONTENT-TYPE"));
+    REQUIRE(hash("X-A-Very-Long-Header-Name") == hash("x-a-very-long-header-name"));
+    REQUIRE(hash("abc") != hash("abd"));
+
+    std::hash<ljh::u16case_insensitive_string> wide_hash;
+    REQUIRE(wide_hash(u"ÉTÉ") == wide_hash(u"été"));
+
+    std::unordered_map<ljh::case_insensitive_string, int> headers;
+    headers["Content-Type"]   = 1;
+    headers["content-length"] = 2;
+    REQUIRE(headers.size() == 2);
+    REQUIRE(headers.at("CONTENT-TYPE") == 1);
+    REQUIRE(headers.at("Content-Length") == 2);
+    headers["CONTENT-LENGTH"] = 3;
+    REQUIRE(headers.size() == 2);
+    REQUIRE(headers.at("content-length") == 3);
+}
@@ -7,6 +7,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include "ljh/char_convertions.hpp"
 #include <cstdint>
+#include <string>
 
 /*
 TEST_CASE("compile time string - hash", "[test_14][compile_time_string]" ) {
@@ -31,4 +32,91 @@ TEST_CASE("compile time string - adding", "[test_14][compile_time_string]" ) {
 	CHECK(one + two == ljh::compile_time_string_literal("ljhlink1j"));
 	CHECK(one + "link1j" == ljh::compile_time_string_literal("ljhlink1j"));
 }
-*/
\ No newline at end of file
+*/
+
+TEST_CASE("from_chars - decimal", "[test_14][char_convertions]" ) {
+	std::string text = "12345678901234567890 tail";
+	std::uint64_t value = 0;
+	auto res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ec == std::errc{});
+	CHECK(res.ptr == text.data() + 20);
+	CHECK(value == 12345678901234567890u);
+
+	int small = 0;
+	CHECK(ljh::from_chars(text.data(), text.data() + 4, small).ec == std::errc{});
+	CHECK(small == 1234);
+
+	CHECK(ljh::from_chars(text.data(), text.data() + 20, small).ec == std::errc::result_out_of_range);
+	CHECK(small == 1234);
+}
+
+TEST_CASE("from_chars - signed", "[test_14][char_convertions]" ) {
+	std::string min = "-128";
+	std::string max = "127";
+	std::string over = "128";
+	signed char value = 0;
+	CHECK(ljh::from_chars(min.data(), min.data() + min.size(), value).ec == std::errc{});
+	CHECK(value == -128);
+	CHECK(ljh::from_chars(max.data(), max.data() + max.size(), value).ec == std::errc{});
+	CHECK(value == 127);
+	CHECK(ljh::from_chars(over.data(), over.data() + over.size(), value).ec == std::errc::result_out_of_range);
+
+	unsigned int u = 5;
+	auto res = ljh::from_chars(min.data(), min.data() + min.size(), u);
+	CHECK(res.ec == std::errc::invalid_argument);
+	CHECK(res.ptr == min.data());
+	CHECK(u == 5);
+}
+
+TEST_CASE("from_chars - leading zeros", "[test_14][char_convertions]" ) {
+	std::string text = "0000000000000000000000000042";
+	std::uint8_t value = 0;
+	CHECK(ljh::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc{});
+	CHECK(value == 42);
+}
+
+constexpr std::uint64_t parse_constexpr(char const* text, int size) {
+	std::uint64_t value = 0;
+	ljh::from_chars(text, text + size, value);
+	return value;
+}
+
+TEST_CASE("from_chars - constexpr", "[test_14][char_convertions]" ) {
+	static_assert(parse_constexpr("1234567887654321", 16) == 1234567887654321u, "");
+	static_assert(parse_constexpr("42", 2) == 42u, "");
+}
+
+TEST_CASE("from_chars - bases", "[test_14][char_convertions]" ) {
+	std::string hex = "DeadBeefg";
+	std::uint32_t value = 0;
+	auto res = ljh::from_chars(hex.data(), hex.data() + hex.size(), value, 16);
+	CHECK(res.ec == std::errc{});
+	CHECK(res.ptr == hex.data() + 8);
+	CHECK(value == 0xDEADBEEF);
+
+	std::wstring bin = L"101012";
+	res.ec = ljh::from_chars(bin.data(), bin.data() + bin.size(), value, 2).ec;
+	CHECK(res.ec == std::errc{});
+	CHECK(value == 21);
+}
+
+#if __cpp_lib_to_chars >= 201611L
+TEST_CASE("from_chars - float", "[test_14][char_convertions]" ) {
+	std::u16string text = u"-1.5e3x";
+	double value = 0;
+	auto res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ec == std::errc{});
+	CHECK(res.ptr == text.data() + 6);
+	CHECK(value == -1500.0);
+}
+#endif
+
+TEST_CASE("from_string", "[test_14][char_convertions]" ) {
+	int value = 0;
+	CHECK(ljh::from_string(value, std::string("-4096")) == std::errc{});
+	CHECK(value == -4096);
+	CHECK(ljh::from_string(value, std::wstring(L"x")) == std::errc::invalid_argument);
+	CHECK(value == -4096);
+	CHECK(ljh::from_string(value, "77") == std::errc{});
+	CHECK(value == 77);
+}
@@ -0,0 +1,134 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/color.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+static bool same(ljh::rgba8 lhs, ljh::rgba8 rhs)
+{
+    return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b && lhs.a == rhs.a;
+}
+
+TEST_CASE("hsl_to_rgb", "[test_20][color]")
+{
+    REQUIRE(ljh::hsl_to_rgb(0, 1, 0.5) == std::make_tuple(255, 0, 0));
+    REQUIRE(ljh::hsl_to_rgb(1. / 3, 1, 0.5) == std::make_tuple(0, 255, 0));
+    REQUIRE(ljh::hsl_to_rgb(2. / 3, 1, 0.5) == std::make_tuple(0, 0, 255));
+    REQUIRE(ljh::hsl_to_rgb(1. / 6, 1, 0.5) == std::make_tuple(255, 255, 0));
+}
+
+TEST_CASE("convert rgba8 <-> hsl/hsv", "[test_20][color]")
+{
+    std::vector<ljh::rgba8> in;
+    for (int r = 0; r < 256; r += 15)
+        for (int g = 0; g < 256; g += 15)
+            for (int b = 0; b < 256; b += 15)
+                in.push_back({uint8_t(r), uint8_t(g), uint8_t(b), uint8_t(r ^ b)});
+
+    std::vector<ljh::hsl_f32> hsl(in.size());
+    std::vector<ljh::hsv_f32> hsv(in.size());
+    std::vector<ljh::rgba8>   out(in.size());
+
+    ljh::convert(in, hsl);
+    ljh::convert(hsl, out);
+    for (std::size_t a = 0; a < in.size(); a++)
+    {
+        auto [h, s, l] = ljh::rgb_to_hsl(in[a].r, in[a].g, in[a].b);
+        REQUIRE(std::abs(h - hsl[a].h) < 1e-5);
+        REQUIRE(std::abs(s - hsl[a].s) < 1e-5);
+        REQUIRE(std::abs(l - hsl[a].l) < 1e-5);
+        REQUIRE(same(in[a], out[a]));
+    }
+
+    ljh::convert(in, hsv);
+    ljh::convert(hsv, out);
+    for (std::size_t a = 0; a < in.size(); a++)
+        REQUIRE(same(in[a], out[a]));
+}
+
+TEST_CASE("srgb <-> linear", "[test_20][color]")
+{
+    REQUIRE(ljh::srgb_to_linear(uint8_t(0)) == 0.f);
+    REQUIRE(ljh::srgb_to_linear(uint8_t(255)) == 1.f);
+
+    std::vector<ljh::rgba8> in(256);
+    for (int a = 0; a < 256; a++)
+        in[a] = {uint8_t(a), uint8_t(255 - a), uint8_t(a / 2), uint8_t(a)};
+
+    std::vector<ljh::rgba_f32> linear(in.size());
+    std::vector<ljh::rgba8>    out(in.size());
+    ljh::srgb_to_linear(in, linear);
+    ljh::linear_to_srgb(linear, out);
+    for (std::size_t a = 0; a < in.size(); a++)
+        REQUIRE(same(in[a], out[a]));
+}
+
+TEST_CASE("premultiply_alpha", "[test_20][color]")
+{
+    std::vector<ljh::rgba8> pixels = {{255, 128, 0, 128}, {10, 20, 30, 0}, {200, 100, 50, 255}};
+    ljh::premultiply_alpha(pixels);
+    REQUIRE(same(pixels[0], {128, 64, 0, 128}));
+    REQUIRE(same(pixels[1], {0, 0, 0, 0}));
+    REQUIRE(same(pixels[2], {200, 100, 50, 255}));
+
+    ljh::unpremultiply_alpha(pixels);
+    REQUIRE(same(pixels[0], {255, 128, 0, 128}));
+    REQUIRE(same(pixels[2], {200, 100, 50, 255}));
+}
+
+TEST_CASE("convert planar buffers", "[test_20][color]")
+{
+    std::vector<ljh::rgba8> in;
+    for (int r = 0; r < 256; r += 15)
+        for (int g = 0; g < 256; g += 15)
+            for (int b = 0; b < 256; b += 15)
+                in.push_back({uint8_t(r), uint8_t(g), uint8_t(b), uint8_t(r ^ b)});
+
+    std::vector<uint8_t> r(in.size()), g(in.size()), b(in.size()), alpha(in.size());
+    for (std::size_t a = 0; a < in.size(); a++)
+    {
+        r[a]     = in[a].r;
+        g[a]     = in[a].g;
+        b[a]     = in[a].b;
+        alpha[a] = in[a].a;
+    }
+    auto planes_match = [&](std::vector<ljh::rgba8> const& pixels) {
+        for (std::size_t a = 0; a < pixels.size(); a++)
+            if (!same(pixels[a], {r[a], g[a], b[a], alpha[a]}))
+                return false;
+        return true;
+    };
+
+    std::vector<ljh::hsl_f32> hsl(in.size());
+    std::vector<float>        h(in.size()), s(in.size()), l(in.size()), fa(in.size());
+    ljh::convert(in, hsl);
+    ljh::convert(ljh::rgba_planes<uint8_t const>{r, g, b, alpha}, ljh::hsl_planes<float>{h, s, l, fa});
+    for (std::size_t a = 0; a < in.size(); a++)
+    {
+        REQUIRE(h[a] == hsl[a].h);
+        REQUIRE(s[a] == hsl[a].s);
+        REQUIRE(l[a] == hsl[a].l);
+        REQUIRE(fa[a] == hsl[a].a);
+    }
+    ljh::convert(ljh::hsl_planes<float const>{h, s, l, fa}, ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+    REQUIRE(planes_match(in));
+
+    ljh::convert(ljh::rgba_planes<uint8_t const>{r, g, b, alpha}, ljh::hsv_planes<float>{h, s, l, fa});
+    ljh::convert(ljh::hsv_planes<float const>{h, s, l, fa}, ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+    REQUIRE(planes_match(in));
+
+    ljh::srgb_to_linear(ljh::rgba_planes<uint8_t const>{r, g, b, alpha}, ljh::rgba_planes<float>{h, s, l, fa});
+    ljh::linear_to_srgb(ljh::rgba_planes<float const>{h, s, l, fa}, ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+    REQUIRE(planes_match(in));
+
+    std::vector<ljh::rgba8> premultiplied = in;
+    ljh::premultiply_alpha(premultiplied);
+    ljh::premultiply_alpha(ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+    REQUIRE(planes_match(premultiplied));
+    ljh::unpremultiply_alpha(premultiplied);
+    ljh::unpremultiply_alpha(ljh::rgba_planes<uint8_t>{r, g, b, alpha});
+    REQUIRE(planes_match(premultiplied));
+}
@@ -0,0 +1,382 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <ljh/coroutine.hpp>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using ljh::co::shared_mutex_policy;
+
+    template<shared_mutex_policy Policy>
+    using policy = std::integral_constant<shared_mutex_policy, Policy>;
+
+    // Keeps the lock, the test unlocks it once it has checked who got in
+    template<typename Awaitable>
+    ljh::co::task<void> take(Awaitable awaitable, std::vector<int>& order, int id)
+    {
+        co_await awaitable;
+        order.push_back(id);
+    }
+} // namespace
+
+#define ALL_POLICIES                                                                                                                           \
+    policy<shared_mutex_policy::fifo>, policy<shared_mutex_policy::reader_preferring>, policy<shared_mutex_policy::writer_preferring>,        \
+        policy<shared_mutex_policy::phase_fair>
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex try_lock", "[test_20][coroutine]", ALL_POLICIES)
+{
+    ljh::co::basic_shared_mutex<TestType::value> mutex;
+
+    CHECK(mutex.try_lock_shared());
+    CHECK(mutex.try_lock_shared());
+    CHECK_FALSE(mutex.try_lock_exclusive());
+    CHECK(mutex.try_lock_upgrade());
+    CHECK_FALSE(mutex.try_lock_upgrade());
+    CHECK_FALSE(mutex.try_upgrade());
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+
+    CHECK(mutex.try_upgrade());
+    CHECK_FALSE(mutex.try_lock_shared());
+    CHECK_FALSE(mutex.try_lock_upgrade());
+    mutex.downgrade_to_upgrade();
+    CHECK(mutex.try_lock_shared());
+    mutex.downgrade_upgrade_to_shared();
+    CHECK(mutex.try_lock_upgrade());
+    mutex.unlock_upgrade();
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+
+    CHECK(mutex.try_lock_exclusive());
+    CHECK_FALSE(mutex.try_lock_exclusive());
+    mutex.downgrade_to_shared();
+    CHECK(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+    CHECK(mutex.try_lock_exclusive());
+    mutex.unlock_exclusive();
+}
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex waiters", "[test_20][coroutine]", ALL_POLICIES)
+{
+    constexpr auto                    policy = TestType::value;
+    ljh::co::basic_shared_mutex<policy> mutex;
+    std::vector<int>                  order;
+
+    // Reader 1, writer 2 and reader 3 queue up behind a writer
+    CHECK(mutex.try_lock_exclusive());
+    auto r1 = take(mutex.lock_shared(), order, 1);
+    auto w2 = take(mutex.lock_exclusive(), order, 2);
+    auto r3 = take(mutex.lock_shared(), order, 3);
+    CHECK(order.empty());
+    mutex.unlock_exclusive();
+
+    if constexpr (policy == shared_mutex_policy::fifo)
+    {
+        CHECK(order == std::vector<int>{1});
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{1, 2});
+        mutex.unlock_exclusive();
+        CHECK(order == std::vector<int>{1, 2, 3});
+        mutex.unlock_shared();
+    }
+    else if constexpr (policy == shared_mutex_policy::writer_preferring)
+    {
+        CHECK(order == std::vector<int>{2});
+        mutex.unlock_exclusive();
+        CHECK(order == std::vector<int>{2, 1, 3});
+        mutex.unlock_shared();
+        mutex.unlock_shared();
+    }
+    else
+    {
+        CHECK(order == std::vector<int>{1, 3});
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{1, 3});
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{1, 3, 2});
+        mutex.unlock_exclusive();
+    }
+    CHECK(mutex.try_lock_exclusive());
+    mutex.unlock_exclusive();
+
+    std::move(r1).get();
+    std::move(w2).get();
+    std::move(r3).get();
+}
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex readers and a waiting writer", "[test_20][coroutine]", ALL_POLICIES)
+{
+    constexpr auto                    policy = TestType::value;
+    ljh::co::basic_shared_mutex<policy> mutex;
+    std::vector<int>                  order;
+
+    CHECK(mutex.try_lock_shared());
+    auto w1 = take(mutex.lock_exclusive(), order, 1);
+    auto r2 = take(mutex.lock_shared(), order, 2);
+    CHECK(mutex.try_lock_shared() == (policy == shared_mutex_policy::reader_preferring));
+
+    if constexpr (policy == shared_mutex_policy::reader_preferring)
+    {
+        // The writer waits for every reader, even ones that came after it
+        CHECK(order == std::vector<int>{2});
+        mutex.unlock_shared();
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{2});
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{2, 1});
+        mutex.unlock_exclusive();
+    }
+    else
+    {
+        CHECK(order.empty());
+        mutex.unlock_shared();
+        CHECK(order == std::vector<int>{1});
+        mutex.unlock_exclusive();
+        CHECK(order == std::vector<int>{1, 2});
+        mutex.unlock_shared();
+    }
+
+    std::move(w1).get();
+    std::move(r2).get();
+}
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex upgrade", "[test_20][coroutine]", ALL_POLICIES)
+{
+    constexpr auto                    policy = TestType::value;
+    ljh::co::basic_shared_mutex<policy> mutex;
+    std::vector<int>                  order;
+
+    CHECK(mutex.try_lock_upgrade());
+    CHECK(mutex.try_lock_shared());
+    auto up = take(mutex.upgrade(), order, 1);
+    CHECK(order.empty());
+
+    // Only a reader preferring mutex lets more readers in while an upgrade waits
+    auto r2 = take(mutex.lock_shared(), order, 2);
+    if constexpr (policy == shared_mutex_policy::reader_preferring)
+    {
+        CHECK(order == std::vector<int>{2});
+        mutex.unlock_shared();
+    }
+    else
+    {
+        CHECK(order.empty());
+    }
+
+    mutex.unlock_shared();
+    CHECK(order.back() == 1);
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock_exclusive();
+    if constexpr (policy == shared_mutex_policy::reader_preferring)
+    {
+        CHECK(order == std::vector<int>{2, 1});
+    }
+    else
+    {
+        CHECK(order == std::vector<int>{1, 2});
+        mutex.unlock_shared();
+    }
+
+    CHECK(mutex.try_lock_exclusive());
+    mutex.unlock_exclusive();
+    std::move(up).get();
+    std::move(r2).get();
+}
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex guards", "[test_20][coroutine]", ALL_POLICIES)
+{
+    ljh::co::basic_shared_mutex<TestType::value> mutex;
+
+    std::move([&]() -> ljh::co::task<void> {
+        {
+            auto guard = co_await mutex.scoped_lock_shared();
+            CHECK(guard.get() == &mutex);
+            CHECK_FALSE(mutex.try_lock_exclusive());
+        }
+        CHECK(mutex.try_lock_exclusive());
+        mutex.unlock_exclusive();
+
+        auto upgrade = co_await mutex.scoped_lock_upgrade();
+        CHECK(mutex.try_lock_shared());
+        mutex.unlock_shared();
+
+        auto exclusive = co_await mutex.scoped_upgrade(std::move(upgrade));
+        CHECK_FALSE(upgrade);
+        CHECK_FALSE(mutex.try_lock_shared());
+        CHECK_FALSE(mutex.try_lock_upgrade());
+
+        exclusive.unlock();
+        CHECK(mutex.try_lock_upgrade());
+        mutex.unlock_upgrade();
+
+        auto moved = co_await mutex.scoped_lock_exclusive();
+        exclusive  = std::move(moved);
+        CHECK_FALSE(moved);
+        CHECK_FALSE(mutex.try_lock_shared());
+    }())
+        .get();
+
+    CHECK(mutex.try_lock_exclusive());
+    mutex.unlock_exclusive();
+}
+
+TEMPLATE_TEST_CASE("co::basic_shared_mutex threads", "[test_20][coroutine]", ALL_POLICIES)
+{
+    ljh::co::basic_shared_mutex<TestType::value> mutex;
+    int                                          value   = 0;
+    std::atomic<int>                             readers = 0;
+    std::atomic<int>                             writers = 0;
+    std::atomic<bool>                            overlap = false;
+
+    std::vector<std::thread> threads;
+    for (int a = 0; a < 4; a++)
+        threads.emplace_back([&, a] {
+            for (int b = 0; b < 500; b++)
+            {
+                [&]() -> ljh::co::task<void> {
+                    if ((a + b) % 3 == 0)
+                    {
+                        auto guard = co_await mutex.scoped_lock_exclusive();
+                        if (writers++ != 0 || readers != 0)
+                            overlap = true;
+                        value++;
+                        writers--;
+                    }
+                    else if (b % 7 == 0)
+                    {
+                        auto upgrade = co_await mutex.scoped_lock_upgrade();
+                        auto guard   = co_await mutex.scoped_upgrade(std::move(upgrade));
+                        if (writers++ != 0 || readers != 0)
+                            overlap = true;
+                        value++;
+                        writers--;
+                    }
+                    else
+                    {
+                        auto guard = co_await mutex.scoped_lock_shared();
+                        readers++;
+                        if (writers != 0)
+                            overlap = true;
+                        readers--;
+                    }
+                }()
+                             .get();
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    int expected = 0;
+    for (int a = 0; a < 4; a++)
+        for (int b = 0; b < 500; b++)
+            expected += (a + b) % 3 == 0 || b % 7 == 0;
+    CHECK_FALSE(overlap);
+    CHECK(value == expected);
+}
+
+TEST_CASE("co::big_reader_shared_mutex", "[test_20][coroutine]")
+{
+    ljh::co::big_reader_shared_mutex mutex;
+    std::vector<int>                 order;
+
+    CHECK(mutex.try_lock_shared());
+    CHECK(mutex.try_lock_shared());
+    CHECK_FALSE(mutex.try_lock_exclusive());
+    // The failed try_lock_exclusive must not keep readers out
+    CHECK(mutex.try_lock_shared());
+
+    // A writer keeps new readers out while it waits for the ones already in
+    auto w1 = take(mutex.lock_exclusive(), order, 1);
+    auto r2 = take(mutex.lock_shared(), order, 2);
+    auto w3 = take(mutex.lock_exclusive(), order, 3);
+    auto r4 = take(mutex.lock_shared(), order, 4);
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    mutex.unlock_shared();
+    CHECK(order.empty());
+
+    // Unlocking from another thread counts on another slot
+    std::thread([&] { mutex.unlock_shared(); }).join();
+    CHECK(order == std::vector<int>{1});
+
+    // The readers that waited go before the next writer
+    mutex.unlock_exclusive();
+    CHECK(order == std::vector<int>{1, 2, 4});
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    CHECK(order == std::vector<int>{1, 2, 4});
+    mutex.unlock_shared();
+    CHECK(order == std::vector<int>{1, 2, 4, 3});
+    mutex.unlock_exclusive();
+
+    CHECK(mutex.try_lock_exclusive());
+    CHECK_FALSE(mutex.try_lock_shared());
+    mutex.unlock_exclusive();
+
+    std::move([&]() -> ljh::co::task<void> {
+        {
+            auto guard = co_await mutex.scoped_lock_exclusive();
+            CHECK_FALSE(mutex.try_lock_shared());
+        }
+        auto guard = co_await mutex.scoped_lock_shared();
+        CHECK_FALSE(mutex.try_lock_exclusive());
+    }())
+        .get();
+    CHECK(mutex.try_lock_exclusive());
+    mutex.unlock_exclusive();
+
+    std::move(w1).get();
+    std::move(r2).get();
+    std::move(w3).get();
+    std::move(r4).get();
+}
+
+TEST_CASE("co::big_reader_shared_mutex threads", "[test_20][coroutine]")
+{
+    ljh::co::big_reader_shared_mutex mutex;
+    int                              value   = 0;
+    std::atomic<int>                 readers = 0;
+    std::atomic<int>                 writers = 0;
+    std::atomic<bool>                overlap = false;
+
+    std::vector<std::thread> threads;
+    for (int a = 0; a < 4; a++)
+        threads.emplace_back([&, a] {
+            for (int b = 0; b < 1000; b++)
+            {
+                [&]() -> ljh::co::task<void> {
+                    if ((a + b) % 10 == 0)
+                    {
+                        auto guard = co_await mutex.scoped_lock_exclusive();
+                        if (writers++ != 0 || readers != 0)
+                            overlap = true;
+                        value++;
+                        writers--;
+                    }
+                    else
+                    {
+                        auto guard = co_await mutex.scoped_lock_shared();
+                        readers++;
+                        if (writers != 0)
+                            overlap = true;
+                        readers--;
+                    }
+                }()
+                             .get();
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK_FALSE(overlap);
+    CHECK(value == 400);
+}
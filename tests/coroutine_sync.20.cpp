@@ -0,0 +1,219 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <ljh/coroutine.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Runs until its first suspension when created, so tests can see what is still waiting
+    ljh::co::task<int> acquire_then(ljh::co::semaphore& sem, std::ptrdiff_t count, std::vector<int>& order, int id)
+    {
+        co_await sem.acquire(count);
+        order.push_back(id);
+        co_return id;
+    }
+
+    template<typename Awaitable>
+    ljh::co::task<void> await_then(Awaitable& awaitable, int& done)
+    {
+        co_await awaitable;
+        done++;
+    }
+
+    template<typename Completion>
+    ljh::co::task<void> barrier_rounds(ljh::co::barrier<Completion>& barrier, int rounds, std::atomic<int>& arrived)
+    {
+        for (int a = 0; a < rounds; a++)
+        {
+            arrived++;
+            co_await barrier.arrive_and_wait();
+        }
+    }
+} // namespace
+
+TEST_CASE("co::semaphore", "[test_20][coroutine]")
+{
+    ljh::co::semaphore sem{2};
+    std::vector<int>   order;
+
+    auto first = acquire_then(sem, 1, order, 1);
+    CHECK(order == std::vector<int>{1});
+    CHECK(sem.available() == 1);
+
+    auto big   = acquire_then(sem, 3, order, 2);
+    auto small = acquire_then(sem, 1, order, 3);
+    CHECK(order == std::vector<int>{1});
+    CHECK_FALSE(sem.try_acquire());
+
+    sem.release(1);
+    CHECK(order == std::vector<int>{1});
+    sem.release(1);
+    CHECK(order == std::vector<int>{1, 2});
+    sem.release(1);
+    CHECK(order == std::vector<int>{1, 2, 3});
+    CHECK(sem.available() == 0);
+
+    CHECK(std::move(first).get() == 1);
+    CHECK(std::move(big).get() == 2);
+    CHECK(std::move(small).get() == 3);
+
+    sem.release(2);
+    CHECK(sem.try_acquire(2));
+    CHECK_FALSE(sem.try_acquire());
+}
+
+TEST_CASE("co::semaphore threads", "[test_20][coroutine]")
+{
+    ljh::co::semaphore       sem{1};
+    int                      inside = 0, most = 0, total = 0;
+    std::vector<std::thread> threads;
+    for (int a = 0; a < 4; a++)
+        threads.emplace_back([&] {
+            for (int b = 0; b < 1000; b++)
+            {
+                [&]() -> ljh::co::task<void> {
+                    co_await sem;
+                    most = std::max(most, ++inside);
+                    total++;
+                    inside--;
+                    sem.release();
+                }()
+                             .get();
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+    CHECK(most == 1);
+    CHECK(total == 4000);
+}
+
+TEST_CASE("co::latch", "[test_20][coroutine]")
+{
+    ljh::co::latch latch{3};
+    int            done = 0;
+    auto           wait = [&]() -> ljh::co::task<void> {
+        co_await latch.wait();
+        done++;
+    };
+
+    auto a = wait();
+    auto b = wait();
+    CHECK(done == 0);
+    CHECK_FALSE(latch.try_wait());
+    latch.count_down(2);
+    CHECK(done == 0);
+    latch.count_down();
+    CHECK(done == 2);
+    CHECK(latch.try_wait());
+
+    std::move(wait()).get();
+    CHECK(done == 3);
+    std::move(a).get();
+    std::move(b).get();
+}
+
+TEST_CASE("co::barrier", "[test_20][coroutine]")
+{
+    int  phases     = 0;
+    auto completion = [&]() noexcept { phases++; };
+
+    SECTION("coroutines")
+    {
+        ljh::co::barrier barrier{3, completion};
+        std::atomic<int> arrived = 0;
+
+        auto a = barrier_rounds(barrier, 2, arrived);
+        auto b = barrier_rounds(barrier, 2, arrived);
+        CHECK(arrived == 2);
+        CHECK(phases == 0);
+
+        auto c = barrier_rounds(barrier, 2, arrived);
+        CHECK(arrived == 6);
+        CHECK(phases == 2);
+        std::move(a).get();
+        std::move(b).get();
+        std::move(c).get();
+    }
+
+    SECTION("arrive and drop")
+    {
+        ljh::co::barrier barrier{2, completion};
+        std::atomic<int> arrived = 0;
+
+        auto a = barrier_rounds(barrier, 3, arrived);
+        CHECK(phases == 0);
+        // Once the drop completes the first phase, the coroutine is the only one left for the rest
+        barrier.arrive_and_drop();
+        CHECK(phases == 3);
+        CHECK(arrived == 3);
+        std::move(a).get();
+    }
+
+    SECTION("threads")
+    {
+        ljh::co::barrier         barrier{4, completion};
+        std::atomic<int>         arrived = 0;
+        std::vector<std::thread> threads;
+        for (int a = 0; a < 4; a++)
+            threads.emplace_back([&] { barrier_rounds(barrier, 100, arrived).get(); });
+        for (auto& thread : threads)
+            thread.join();
+        CHECK(arrived == 400);
+        CHECK(phases == 100);
+    }
+}
+
+TEST_CASE("co::manual_reset_event", "[test_20][coroutine]")
+{
+    ljh::co::manual_reset_event event;
+    int                         done = 0;
+
+    auto a = await_then(event, done);
+    auto b = await_then(event, done);
+    CHECK(done == 0);
+    event.set();
+    CHECK(done == 2);
+    CHECK(event.is_set());
+
+    std::move(await_then(event, done)).get();
+    CHECK(done == 3);
+
+    event.reset();
+    auto c = await_then(event, done);
+    CHECK(done == 3);
+    event.set();
+    CHECK(done == 4);
+
+    std::move(a).get();
+    std::move(b).get();
+    std::move(c).get();
+}
+
+TEST_CASE("co::auto_reset_event", "[test_20][coroutine]")
+{
+    ljh::co::auto_reset_event event;
+    int                       done = 0;
+
+    auto a = await_then(event, done);
+    auto b = await_then(event, done);
+    event.set();
+    CHECK(done == 1);
+    CHECK_FALSE(event.is_set());
+    event.set();
+    CHECK(done == 2);
+
+    event.set();
+    CHECK(event.is_set());
+    std::move(await_then(event, done)).get();
+    CHECK(done == 3);
+    CHECK_FALSE(event.is_set());
+
+    std::move(a).get();
+    std::move(b).get();
+}
@@ -0,0 +1,69 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <ljh/coroutine.hpp>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	struct traced_result
+	{
+		int value;
+	};
+
+	ljh::co::task<traced_result> hold(ljh::co::shared_mutex& mutex)
+	{
+		co_await mutex.lock_exclusive();
+		co_return traced_result{1};
+	}
+
+	ljh::co::task<traced_result> wait_for(ljh::co::shared_mutex& mutex)
+	{
+		co_await mutex.lock_exclusive();
+		mutex.unlock_exclusive();
+		co_return traced_result{2};
+	}
+} // namespace
+
+TEST_CASE("coroutine tracing", "[test_20][coroutine]")
+{
+	using ljh::co::trace::event;
+	ljh::co::trace::drain([](ljh::co::trace::record const&) {});
+	auto before = ljh::co::trace::get_counters();
+
+	ljh::co::shared_mutex mutex;
+	CHECK(std::move(hold(mutex)).get().value == 1);
+
+	auto waiter = wait_for(mutex);
+	auto during = ljh::co::trace::get_counters();
+	CHECK(during[event::wait_begin] - before[event::wait_begin] == 1);
+	CHECK(during[event::wait_end] == before[event::wait_end]);
+	CHECK(during.in_flight() - before.in_flight() == 1);
+
+	mutex.unlock_exclusive();
+	CHECK(std::move(waiter).get().value == 2);
+
+	auto after = ljh::co::trace::get_counters();
+	CHECK(after[event::created] - before[event::created] == 2);
+	CHECK(after[event::started] - before[event::started] == 2);
+	CHECK(after[event::completed] - before[event::completed] == 2);
+	CHECK(after[event::wait_end] - before[event::wait_end] == 1);
+	CHECK(after[event::suspended] - before[event::suspended] == 1);
+	CHECK(after[event::resumed] - before[event::resumed] == 1);
+	CHECK(after.dropped == before.dropped);
+
+	std::ostringstream out;
+	CHECK(ljh::co::trace::write_chrome_trace(out) == 10);
+	auto json = out.str();
+	CHECK(json.rfind(R"({"displayTimeUnit":"ns","traceEvents":[)", 0) == 0);
+	CHECK(json.find(R"("ph":"b","name":"wait")") != std::string::npos);
+	CHECK(json.find(R"("ph":"e","name":"suspended")") != std::string::npos);
+	CHECK(json.find("\n]}\n") == json.size() - 4);
+
+	std::ostringstream empty;
+	CHECK(ljh::co::trace::write_chrome_trace(empty) == 0);
+}
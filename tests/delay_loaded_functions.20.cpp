@@ -25,4 +25,28 @@ TEST_CASE("delay_loaded_functions", "[test_20][delay_loaded_functions]" ) {
 #endif
 	REQUIRE(function_test.is_loadable());
 }
+#if defined(LJH_TARGET_Windows)
+#define LIBC_NAME "msvcrt.dll"
+#elif defined(LJH_TARGET_MacOS)
+#define LIBC_NAME "libSystem.B.dylib"
+#else
+#define LIBC_NAME "libc.so.6"
+#endif
+
+TEST_CASE("delay_loaded_functions - cached calls", "[test_20][delay_loaded_functions]")
+{
+	ljh::delay_load::function<LIBC_NAME, "abs", int(int)>                    absolute;
+	ljh::delay_load::function<LIBC_NAME, "ljh_not_a_real_function", void()> missing;
+
+	REQUIRE(ljh::delay_load::bind_all(absolute));
+	REQUIRE(absolute(-3) == 3);
+	REQUIRE(absolute(4) == 4);
+
+	REQUIRE_FALSE(missing.is_loadable());
+	REQUIRE_FALSE(missing);
+	REQUIRE_FALSE(ljh::delay_load::bind_all(absolute, missing));
+
+	// Other objects of the same function share the looked up pointer
+	REQUIRE(ljh::delay_load::function<LIBC_NAME, "abs", int(int)>{}(-5) == 5);
+}
 #endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/dispatch.hpp"
+#include <memory>
+
+static int resolves = 0;
+static int add(int a, int b) { return a + b; }
+static int sub(int a, int b) { return a - b; }
+static bool use_sub = false;
+
+static auto pick_math()
+{
+	resolves++;
+	return use_sub ? &sub : &add;
+}
+
+static int consume(std::unique_ptr<int> value) noexcept { return *value; }
+static auto pick_consume() noexcept { return &consume; }
+
+TEST_CASE("dispatch resolves once", "[test_17][dispatch]")
+{
+	resolves = 0;
+	use_sub  = false;
+	ljh::dispatch<pick_math>.reset();
+
+	REQUIRE(ljh::dispatch<pick_math>(2, 3) == 5);
+	REQUIRE(ljh::dispatch<pick_math>(4, 3) == 7);
+	REQUIRE(resolves == 1);
+	REQUIRE(ljh::dispatch<pick_math>.get() == &add);
+	REQUIRE(resolves == 1);
+}
+
+TEST_CASE("dispatch reset", "[test_17][dispatch]")
+{
+	resolves = 0;
+	use_sub  = true;
+	ljh::dispatch<pick_math>.reset();
+
+	REQUIRE(ljh::dispatch<pick_math>.get() == &sub);
+	REQUIRE(resolves == 1);
+	REQUIRE(ljh::dispatch<pick_math>(2, 3) == -1);
+	REQUIRE(resolves == 1);
+
+	use_sub = false;
+	ljh::dispatch<pick_math>.reset();
+	REQUIRE(ljh::dispatch<pick_math>(2, 3) == 5);
+	REQUIRE(resolves == 2);
+}
+
+TEST_CASE("dispatch move only and noexcept", "[test_17][dispatch]")
+{
+	STATIC_REQUIRE(noexcept(ljh::dispatch<pick_consume>(std::unique_ptr<int>{})));
+	REQUIRE(ljh::dispatch<pick_consume>(std::make_unique<int>(42)) == 42);
+	REQUIRE(ljh::dispatch<pick_consume>(std::make_unique<int>(7)) == 7);
+}
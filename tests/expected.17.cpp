@@ -6,6 +6,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include "ljh/expected.hpp"
+#include <string>
 #include <type_traits>
 
 struct trivial_data_type
@@ -136,4 +137,217 @@ TEST_CASE("expected<trivial_data_type, not_copy>::emplace", "[test_17][expected]
             REQUIRE(!test.has_value());
         }
     }
-}
\ No newline at end of file
+}
+enum class test_errc
+{
+    success,
+    failed,
+};
+
+template<>
+struct ljh::expected_niche<test_errc> : ljh::expected_niche_value<test_errc, test_errc::success>
+{};
+
+static_assert(std::is_trivially_copyable<ljh::expected<int, int>>::value);
+static_assert(std::is_trivially_copyable<ljh::expected<void, int>>::value);
+static_assert(std::is_trivially_copyable<ljh::expected<trivial_data_type, test_errc>>::value);
+static_assert(!std::is_trivially_copyable<ljh::expected<std::string, int>>::value);
+static_assert(sizeof(ljh::expected<void, test_errc>) == sizeof(test_errc));
+static_assert(sizeof(ljh::expected<void, int>) == 2 * sizeof(int));
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+#if defined(__cpp_lib_expected)
+static_assert(sizeof(ljh::expected<int, int>) == sizeof(std::expected<int, int>));
+static_assert(!std::is_trivially_copyable<std::expected<int, int>>::value || std::is_trivially_copyable<ljh::expected<int, int>>::value);
+#endif
+
+static ljh::expected<int, std::string> parse_digit(char c)
+{
+    if (c < '0' || c > '9')
+        return ljh::unexpected{std::string{"not a digit"}};
+    return c - '0';
+}
+
+TEST_CASE("expected monadic operations", "[test_17][expected][monadic]")
+{
+    ljh::expected<char, std::string> good = '7';
+    ljh::expected<char, std::string> bad  = ljh::unexpected{std::string{"empty"}};
+
+    SECTION("and_then")
+    {
+        REQUIRE(good.and_then(parse_digit) == 7);
+        REQUIRE(bad.and_then(parse_digit).error() == "empty");
+        REQUIRE(ljh::expected<char, std::string>{'x'}.and_then(parse_digit).error() == "not a digit");
+    }
+
+    SECTION("or_else")
+    {
+        auto recover = [](std::string const&) { return ljh::expected<char, std::string>{'0'}; };
+        REQUIRE(good.or_else(recover) == '7');
+        REQUIRE(bad.or_else(recover) == '0');
+        REQUIRE(std::move(bad).or_else([](std::string&& error) { return ljh::expected<char, int>{ljh::unexpect, int(error.size())}; }).error() == 5);
+    }
+
+    SECTION("transform")
+    {
+        auto next = good.transform([](char c) { return c + 1; });
+        static_assert(std::is_same_v<decltype(next), ljh::expected<int, std::string>>);
+        REQUIRE(next == '8');
+        REQUIRE(bad.transform([](char c) { return c + 1; }).error() == "empty");
+
+        int calls = 0;
+        ljh::expected<void, std::string> done = good.transform([&](char) { calls++; });
+        REQUIRE(done.has_value());
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("transform_error")
+    {
+        auto size = bad.transform_error([](std::string const& error) { return error.size(); });
+        static_assert(std::is_same_v<decltype(size), ljh::expected<char, std::size_t>>);
+        REQUIRE(size.error() == 5);
+        REQUIRE(good.transform_error([](std::string const& error) { return error.size(); }) == '7');
+    }
+
+    SECTION("void value")
+    {
+        ljh::expected<void, int> ok;
+        REQUIRE(ok.and_then([] { return ljh::expected<int, int>{3}; }) == 3);
+        REQUIRE(ok.transform([] { return 4; }) == 4);
+        REQUIRE(ljh::expected<void, int>{ljh::unexpect, 2}.transform_error([](int e) { return e * 2; }).error() == 4);
+    }
+}
+
+TEST_CASE("expected with a niche error", "[test_17][expected]")
+{
+    ljh::expected<void, test_errc> test;
+    REQUIRE(test.has_value());
+
+    test = ljh::unexpected{test_errc::failed};
+    REQUIRE(!test.has_value());
+    REQUIRE(test.error() == test_errc::failed);
+
+    test.emplace();
+    REQUIRE(test.has_value());
+
+    ljh::expected<std::string, test_errc> text{"value"};
+    ljh::expected<std::string, test_errc> failed{ljh::unexpect, test_errc::failed};
+    REQUIRE(*text == "value");
+    text.swap(failed);
+    REQUIRE(!text.has_value());
+    REQUIRE(*failed == "value");
+    REQUIRE(text.transform_error([](test_errc) { return 1; }).error() == 1);
+}
+
+TEST_CASE("expected copies and moves", "[test_17][expected]")
+{
+    ljh::expected<std::string, int> text{"some text long enough to not fit in the small buffer"};
+    ljh::expected<std::string, int> copy = text;
+    REQUIRE(*copy == *text);
+
+    ljh::expected<std::string, int> moved = std::move(copy);
+    REQUIRE(*moved == *text);
+
+    copy = ljh::unexpected{1};
+    REQUIRE(copy.error() == 1);
+    copy = moved;
+    REQUIRE(*copy == *text);
+    moved = ljh::unexpected{2};
+    copy  = std::move(moved);
+    REQUIRE(copy.error() == 2);
+
+    REQUIRE_THROWS_AS(copy.value(), ljh::bad_expected_access<int>);
+    REQUIRE(copy.value_or("other") == "other");
+}
+
+namespace
+{
+    // Throws from its copy constructor on request and counts the objects that are alive
+    struct throw_on_copy
+    {
+        static inline int  alive      = 0;
+        static inline bool throw_next = false;
+
+        int value;
+
+        explicit throw_on_copy(int value)
+            : value(value)
+        {
+            alive++;
+        }
+        throw_on_copy(throw_on_copy const& rhs)
+            : value(rhs.value)
+        {
+            if (throw_next)
+                throw 1;
+            alive++;
+        }
+        throw_on_copy& operator=(throw_on_copy const&) = default;
+        ~throw_on_copy()
+        {
+            alive--;
+        }
+    };
+} // namespace
+
+TEST_CASE("expected stays valid when a copy throws", "[test_17][expected]")
+{
+    using test_t = ljh::expected<throw_on_copy, std::string>;
+    {
+        test_t value{ljh::in_place, 1};
+        test_t error{ljh::unexpect, "error that is long enough to allocate"};
+
+        throw_on_copy::throw_next = true;
+        CHECK_THROWS(test_t(value));
+        CHECK(throw_on_copy::alive == 1);
+
+        // The error has to stay alive when making the value throws
+        test_t lhs = error;
+        CHECK_THROWS(lhs = value);
+        REQUIRE_FALSE(lhs.has_value());
+        CHECK(lhs.error() == error.error());
+
+        CHECK_THROWS(lhs = *value);
+        REQUIRE_FALSE(lhs.has_value());
+        CHECK(lhs.error() == error.error());
+        CHECK(throw_on_copy::alive == 1);
+
+        test_t with_value{ljh::in_place, 2};
+        CHECK_THROWS(with_value.emplace(*value));
+        REQUIRE(with_value.has_value());
+        CHECK(with_value->value == 2);
+        CHECK(throw_on_copy::alive == 2);
+
+        throw_on_copy::throw_next = false;
+        lhs                       = value;
+        REQUIRE(lhs.has_value());
+        CHECK(lhs->value == 1);
+        lhs = error;
+        CHECK_FALSE(lhs.has_value());
+        CHECK(throw_on_copy::alive == 2);
+    }
+    CHECK(throw_on_copy::alive == 0);
+
+    using error_t = ljh::expected<int, throw_on_copy>;
+    {
+        error_t                         value{5};
+        ljh::unexpected<throw_on_copy> const error{throw_on_copy{3}};
+        CHECK(throw_on_copy::alive == 1);
+
+        // The value has to stay alive when making the error throws
+        throw_on_copy::throw_next = true;
+        CHECK_THROWS(value = error);
+        REQUIRE(value.has_value());
+        CHECK(*value == 5);
+        CHECK(throw_on_copy::alive == 1);
+
+        throw_on_copy::throw_next = false;
+        value                     = error;
+        REQUIRE_FALSE(value.has_value());
+        CHECK(value.error().value == 3);
+        CHECK(throw_on_copy::alive == 2);
+    }
+    CHECK(throw_on_copy::alive == 0);
+}
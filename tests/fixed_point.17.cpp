@@ -0,0 +1,74 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/fixed_point.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+using q16 = ljh::fixed_point<32, 16, true>;
+using u16 = ljh::fixed_point<32, 16, false>;
+
+TEST_CASE("fixed_point saturating_add", "[test_17][fixed_point]")
+{
+    constexpr auto max = q16::from_raw(0x7FFF'FFFF);
+    constexpr auto min = q16::from_raw(-0x7FFF'FFFF - 1);
+
+    static_assert(ljh::saturating_add(q16(1), q16(2)) == q16(3));
+    static_assert(ljh::saturating_add(max, q16(1)) == max);
+    static_assert(ljh::saturating_add(min, q16(-1)) == min);
+    static_assert(ljh::saturating_sub(min, q16(1)) == min);
+    static_assert(ljh::saturating_sub(max, q16(-1)) == max);
+    static_assert(ljh::saturating_sub(u16(1), u16(2)) == u16(0));
+    static_assert(ljh::saturating_add(u16::from_raw(0xFFFF'FFFF), u16(1)) == u16::from_raw(0xFFFF'FFFF));
+}
+
+TEST_CASE("fixed_point sqrt", "[test_17][fixed_point]")
+{
+    static_assert(ljh::sqrt(q16(16)) == q16(4));
+    static_assert(ljh::sqrt(q16(-4)) == q16(0));
+    static_assert(ljh::sqrt(ljh::fixed_point<64, 32, true>(81)) == ljh::fixed_point<64, 32, true>(9));
+
+    for (double v : {0.25, 2.0, 10.5, 1234.0})
+        REQUIRE(std::abs(double(ljh::sqrt(q16(v))) - std::sqrt(v)) < 1.0 / 65536.0);
+}
+
+TEST_CASE("fixed_point reciprocal", "[test_17][fixed_point]")
+{
+    static_assert(ljh::reciprocal(q16(4)) == q16(0.25));
+    static_assert(ljh::reciprocal(q16(-2)) == q16(-0.5));
+}
+
+TEST_CASE("fixed_point sin/cos", "[test_17][fixed_point]")
+{
+    static_assert(ljh::sin(q16(0)) == q16(0));
+    static_assert(ljh::cos(q16(0)) == q16(1));
+
+    for (double v = -10.0; v < 10.0; v += 0.1)
+    {
+        REQUIRE(std::abs(double(ljh::sin(q16(v))) - std::sin(v)) < 0.001);
+        REQUIRE(std::abs(double(ljh::cos(q16(v))) - std::cos(v)) < 0.001);
+        REQUIRE(std::abs(double(ljh::sin(ljh::fixed_point<64, 40, true>(v))) - std::sin(v)) < 0.0001);
+    }
+}
+
+TEST_CASE("fixed_point_vec", "[test_17][fixed_point]")
+{
+    using vec = ljh::fixed_point_vec<q16, 4>;
+
+    constexpr q16 data[] = {1, 2, 3, 4};
+    constexpr vec a      = vec::load(data);
+    constexpr vec b      = vec::broadcast(2);
+
+    static_assert((a * b)[3] == q16(8));
+    static_assert((a / b)[0] == q16(0.5));
+    static_assert((a + b)[1] == q16(4));
+    static_assert((a - b)[2] == q16(1));
+    static_assert(ljh::sqrt(a * a) == a);
+
+    q16 out[4];
+    (a + a).store(out);
+    REQUIRE(out[0] == q16(2));
+    REQUIRE(out[3] == q16(8));
+}
@@ -0,0 +1,155 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/function.hpp"
+#include <array>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+static int add_one(int value)
+{
+    return value + 1;
+}
+
+struct counted
+{
+    static inline int alive = 0;
+    int               value;
+
+    explicit counted(int value)
+        : value(value)
+    {
+        alive++;
+    }
+    counted(counted&& other) noexcept
+        : value(other.value)
+    {
+        alive++;
+    }
+    ~counted()
+    {
+        alive--;
+    }
+    int operator()(int a)
+    {
+        return value + a;
+    }
+};
+
+static_assert(!std::is_copy_constructible_v<ljh::inplace_function<void()>>);
+static_assert(std::is_nothrow_move_constructible_v<ljh::move_only_function<void()>>);
+static_assert(sizeof(ljh::function_ref<void()>) == 2 * sizeof(void*));
+static_assert(std::is_constructible_v<ljh::inplace_function<int(int)>, int (*)(int)>);
+static_assert(!std::is_constructible_v<ljh::inplace_function<int(int)>, int (*)(std::string)>);
+#if __cpp_noexcept_function_type >= 201510L
+static_assert(!std::is_constructible_v<ljh::inplace_function<int(int) noexcept>, int (*)(int)>);
+static_assert(std::is_constructible_v<ljh::inplace_function<int(int) noexcept>, int (*)(int) noexcept>);
+static_assert(std::is_nothrow_invocable_v<ljh::move_only_function<void() noexcept>&>);
+#endif
+
+TEST_CASE("inplace_function", "[test_17][function]")
+{
+    ljh::inplace_function<int(int)> empty;
+    REQUIRE(!empty);
+    REQUIRE(empty == nullptr);
+    REQUIRE_THROWS_AS(empty(1), std::bad_function_call);
+
+    ljh::inplace_function<int(int)> pointer = &add_one;
+    REQUIRE(pointer(1) == 2);
+
+    int (*null)(int) = nullptr;
+    REQUIRE(!ljh::inplace_function<int(int)>{null});
+
+    std::array<int, 4> data{1, 2, 3, 4};
+    ljh::inplace_function<int(int), 24> capture = [data](int index) { return data[index]; };
+    REQUIRE(capture(2) == 3);
+
+    auto moved = std::move(capture);
+    REQUIRE(!capture);
+    REQUIRE(moved(3) == 4);
+
+    moved = [](int a) { return a * 10; };
+    REQUIRE(moved(3) == 30);
+
+    SECTION("owns what it holds")
+    {
+        {
+            ljh::inplace_function<int(int)> f{std::in_place_type<counted>, 5};
+            REQUIRE(counted::alive == 1);
+            REQUIRE(f(1) == 6);
+
+            ljh::inplace_function<int(int)> g = std::move(f);
+            REQUIRE(counted::alive == 1);
+            REQUIRE(g(2) == 7);
+
+            g = nullptr;
+            REQUIRE(counted::alive == 0);
+            g = counted{1};
+            REQUIRE(counted::alive == 1);
+        }
+        REQUIRE(counted::alive == 0);
+    }
+
+    SECTION("move only callables")
+    {
+        ljh::inplace_function<int()> f = [value = std::make_unique<int>(42)] { return *value; };
+        ljh::inplace_function<int()> g;
+        swap(f, g);
+        REQUIRE(!f);
+        REQUIRE(g() == 42);
+    }
+}
+
+TEST_CASE("move_only_function", "[test_17][function]")
+{
+    std::array<long long, 16> big{};
+    big[15] = 7;
+    ljh::move_only_function<long long()> heap = [big] { return big[15]; };
+    REQUIRE(heap() == 7);
+
+    auto moved = std::move(heap);
+    REQUIRE(!heap);
+    REQUIRE(moved() == 7);
+
+    {
+        ljh::move_only_function<int(int), 8> f = counted{3};
+        REQUIRE(counted::alive == 1);
+        auto g = std::move(f);
+        REQUIRE(counted::alive == 1);
+        REQUIRE(g(1) == 4);
+    }
+    REQUIRE(counted::alive == 0);
+
+    ljh::move_only_function<void(std::string&)> append = [suffix = std::string(64, '!')](std::string& text) { text += suffix; };
+    std::string text;
+    append(text);
+    REQUIRE(text.size() == 64);
+}
+
+TEST_CASE("function_ref", "[test_17][function]")
+{
+    int  total = 0;
+    auto add   = [&total](int value) { total += value; };
+
+    auto call_with = [](ljh::function_ref<void(int)> callback) {
+        for (int a = 1; a <= 3; a++)
+            callback(a);
+    };
+    call_with(add);
+    REQUIRE(total == 6);
+
+    ljh::function_ref<int(int)> pointer = add_one;
+    REQUIRE(pointer(1) == 2);
+    pointer = &add_one;
+    REQUIRE(pointer(2) == 3);
+
+    counted                     object{10};
+    ljh::function_ref<int(int)> member = object;
+    object.value                       = 20;
+    REQUIRE(member(1) == 21);
+}
@@ -0,0 +1,255 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/ipc_ring.hpp"
+#include "ljh/os_build_info.hpp"
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(LJH_TARGET_Linux)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace std::chrono_literals;
+
+struct shared_memory
+{
+	std::size_t size;
+	std::byte*  data;
+
+	explicit shared_memory(std::size_t size)
+		: size(size)
+		, data(static_cast<std::byte*>(::operator new(size, std::align_val_t{64})))
+	{
+		std::memset(data, 0, size);
+	}
+	~shared_memory() { ::operator delete(data, std::align_val_t{64}); }
+};
+
+struct message
+{
+	std::uint32_t producer;
+	std::uint32_t sequence;
+};
+
+static std::span<std::byte const> bytes_of(message const& value)
+{
+	return std::as_bytes(std::span{&value, 1});
+}
+
+TEST_CASE("ipc_ring - records keep their size and order", "[test_20][ipc_ring]")
+{
+	shared_memory      memory{ljh::ipc::spsc_ring::required_size(256)};
+	ljh::ipc::spsc_ring ring{memory.data, memory.size};
+	REQUIRE(ring.capacity() == 256);
+
+	REQUIRE_FALSE(ring.try_read([](auto) { FAIL(); }));
+	REQUIRE_FALSE(ring.read_for([](auto) { FAIL(); }, 1ms));
+
+	std::array<std::byte, 200> big{};
+	REQUIRE(ring.try_write(big));
+	REQUIRE_FALSE(ring.try_write(big));
+	REQUIRE_FALSE(ring.write_for(big, 1ms));
+	REQUIRE(ring.try_read([](std::span<std::byte const> record) { REQUIRE(record.size() == 200); }));
+
+	// Enough rounds to wrap around the ring several times with odd sizes
+	for (int round = 0; round < 50; round++)
+	{
+		for (std::size_t size : {0, 1, 7, 13, 40})
+			REQUIRE(ring.try_emplace(size, [&](std::span<std::byte> record) { std::memset(record.data(), int(size + round), record.size()); }));
+
+		for (std::size_t size : {0, 1, 7, 13, 40})
+		{
+			REQUIRE(ring.try_read([&](std::span<std::byte const> record) {
+				REQUIRE(record.size() == size);
+				for (auto b : record)
+					REQUIRE(b == std::byte(size + round));
+			}));
+		}
+		REQUIRE(ring.size_approx() == 0);
+	}
+}
+
+TEST_CASE("ipc_ring - rejects mismatched memory", "[test_20][ipc_ring]")
+{
+	shared_memory memory{ljh::ipc::mpsc_ring::required_size(1024)};
+	ljh::ipc::mpsc_ring ring{memory.data, memory.size};
+	REQUIRE_THROWS_AS(ljh::ipc::spsc_ring(memory.data, memory.size), std::invalid_argument);
+	REQUIRE_THROWS_AS(ljh::ipc::spsc_ring(memory.data + 8, memory.size - 8), std::invalid_argument);
+
+	std::vector<std::byte> too_big(ring.max_record_size() + 1);
+	REQUIRE_THROWS_AS(ring.try_write(too_big), std::length_error);
+}
+
+TEST_CASE("ipc_ring - a throwing fill doesn't block the ring", "[test_20][ipc_ring]")
+{
+	shared_memory      memory{ljh::ipc::mpsc_ring::required_size(256)};
+	ljh::ipc::mpsc_ring ring{memory.data, memory.size};
+
+	// Enough rounds for the skipped records to wrap around the ring
+	for (std::uint32_t a = 0; a < 20; a++)
+	{
+		REQUIRE_THROWS_AS(ring.emplace(40, [](std::span<std::byte> record) {
+			std::memset(record.data(), 0xFF, record.size());
+			throw std::runtime_error("fill failed");
+		}), std::runtime_error);
+		ring.write(bytes_of(message{0, a}));
+
+		REQUIRE(ring.try_read([&](std::span<std::byte const> record) {
+			message value;
+			REQUIRE(record.size() == sizeof(value));
+			std::memcpy(&value, record.data(), sizeof(value));
+			REQUIRE(value.sequence == a);
+		}));
+		REQUIRE_FALSE(ring.try_read([](auto) { FAIL(); }));
+		REQUIRE(ring.size_approx() == 0);
+	}
+}
+
+TEST_CASE("ipc_ring - spsc across threads", "[test_20][ipc_ring]")
+{
+	shared_memory      memory{ljh::ipc::spsc_ring::required_size(4096)};
+	ljh::ipc::spsc_ring producer{memory.data, memory.size};
+	ljh::ipc::spsc_ring consumer{memory.data, memory.size};
+	constexpr std::uint32_t count = 100'000;
+
+	std::thread thread{[&] {
+		for (std::uint32_t a = 0; a < count; a++)
+			producer.write(bytes_of(message{0, a}));
+	}};
+
+	std::uint32_t expected = 0;
+	while (expected < count)
+	{
+		consumer.read([&](std::span<std::byte const> record) {
+			message value;
+			REQUIRE(record.size() == sizeof(value));
+			std::memcpy(&value, record.data(), sizeof(value));
+			REQUIRE(value.sequence == expected);
+		});
+		expected++;
+	}
+	thread.join();
+	REQUIRE_FALSE(consumer.try_read([](auto) {}));
+}
+
+TEST_CASE("ipc_ring - mpsc across threads", "[test_20][ipc_ring]")
+{
+	shared_memory      memory{ljh::ipc::mpsc_ring::required_size(4096)};
+	ljh::ipc::mpsc_ring consumer{memory.data, memory.size};
+	constexpr std::uint32_t producers = 4;
+	constexpr std::uint32_t count     = 25'000;
+
+	std::vector<std::thread> threads;
+	for (std::uint32_t p = 0; p < producers; p++)
+	{
+		threads.emplace_back([&, p] {
+			ljh::ipc::mpsc_ring producer{memory.data, memory.size};
+			for (std::uint32_t a = 0; a < count; a++)
+			{
+				// Vary the size so records wrap at different offsets
+				message                                    value{p, a};
+				std::array<std::byte, sizeof(message) + 24> record{};
+				std::memcpy(record.data(), &value, sizeof(value));
+				producer.write(std::span{record}.first(sizeof(message) + a % 25));
+			}
+		});
+	}
+
+	std::array<std::uint32_t, producers> next{};
+	for (std::uint32_t received = 0; received < producers * count; received++)
+	{
+		consumer.read([&](std::span<std::byte const> record) {
+			message value;
+			std::memcpy(&value, record.data(), sizeof(value));
+			REQUIRE(value.producer < producers);
+			REQUIRE(value.sequence == next[value.producer]);
+			REQUIRE(record.size() == sizeof(message) + value.sequence % 25);
+			next[value.producer]++;
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+	for (auto n : next)
+		REQUIRE(n == count);
+}
+
+TEST_CASE("ipc_ring - mpsc object shared by threads", "[test_20][ipc_ring]")
+{
+	shared_memory      memory{ljh::ipc::mpsc_ring::required_size(1024)};
+	ljh::ipc::mpsc_ring ring{memory.data, memory.size};
+	constexpr std::uint32_t producers = 4;
+	constexpr std::uint32_t count     = 25'000;
+
+	std::vector<std::thread> threads;
+	for (std::uint32_t p = 0; p < producers; p++)
+	{
+		threads.emplace_back([&, p] {
+			for (std::uint32_t a = 0; a < count; a++)
+				ring.write(bytes_of(message{p, a}));
+		});
+	}
+
+	std::array<std::uint32_t, producers> next{};
+	for (std::uint32_t received = 0; received < producers * count; received++)
+	{
+		ring.read([&](std::span<std::byte const> record) {
+			message value;
+			REQUIRE(record.size() == sizeof(value));
+			std::memcpy(&value, record.data(), sizeof(value));
+			REQUIRE(value.producer < producers);
+			REQUIRE(value.sequence == next[value.producer]);
+			next[value.producer]++;
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+	REQUIRE_FALSE(ring.try_read([](auto) {}));
+}
+
+#if defined(LJH_TARGET_Linux)
+TEST_CASE("ipc_ring - mapped ring across processes", "[test_20][ipc_ring]")
+{
+	auto path = std::filesystem::temp_directory_path() / "ljh_test_ipc_ring";
+	std::filesystem::remove(path);
+	constexpr std::uint32_t count = 10'000;
+
+	ljh::ipc::mapped_ring<ljh::ipc::spsc_ring> consumer{path, 1024};
+
+	pid_t child = fork();
+	if (child == 0)
+	{
+		ljh::ipc::mapped_ring<ljh::ipc::spsc_ring> producer{path, 1024};
+		for (std::uint32_t a = 0; a < count; a++)
+			producer->write(bytes_of(message{1, a}));
+		_exit(0);
+	}
+	REQUIRE(child > 0);
+
+	bool in_order = true;
+	for (std::uint32_t a = 0; a < count; a++)
+	{
+		consumer->read([&](std::span<std::byte const> record) {
+			message value;
+			std::memcpy(&value, record.data(), sizeof(value));
+			in_order &= value.sequence == a;
+		});
+	}
+	REQUIRE(in_order);
+
+	int status = 0;
+	waitpid(child, &status, 0);
+	REQUIRE(WIFEXITED(status));
+	std::filesystem::remove(path);
+}
+#endif
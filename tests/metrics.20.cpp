@@ -0,0 +1,146 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/metrics.hpp"
+#include <thread>
+#include <vector>
+
+#if __cpp_lib_format >= 201907L
+#include "ljh/format/ranges.hpp"
+#include <format>
+#endif
+
+TEST_CASE("metrics::counter", "[test_20][metrics]")
+{
+    ljh::metrics::counter counter;
+    CHECK(counter.value() == 0);
+    counter++;
+    ++counter;
+    counter += 5;
+    CHECK(counter.value() == 7);
+
+    std::vector<std::thread> threads;
+    for (int a = 0; a < 8; a++)
+        threads.emplace_back([&] {
+            for (int b = 0; b < 10000; b++)
+                counter.add();
+        });
+    for (auto& thread : threads)
+        thread.join();
+    CHECK(counter.value() == 80007);
+    CHECK(counter.take() == 80007);
+    CHECK(counter.value() == 0);
+}
+
+TEST_CASE("metrics::gauge", "[test_20][metrics]")
+{
+    ljh::metrics::gauge gauge{10};
+    STATIC_REQUIRE(alignof(ljh::metrics::gauge) >= 64);
+    gauge += 5;
+    gauge -= 20;
+    CHECK(gauge.value() == -5);
+    gauge = 3;
+    CHECK(gauge.value() == 3);
+}
+
+TEST_CASE("metrics::histogram_buckets", "[test_20][metrics]")
+{
+    using buckets = ljh::metrics::histogram_buckets<5>;
+    STATIC_REQUIRE(buckets::count == 1920);
+    STATIC_REQUIRE(buckets::index_of(0) == 0);
+    STATIC_REQUIRE(buckets::index_of(31) == 31);
+    STATIC_REQUIRE(buckets::index_of(32) == 32);
+    STATIC_REQUIRE(buckets::index_of(63) == 63);
+    STATIC_REQUIRE(buckets::index_of(64) == 64);
+    STATIC_REQUIRE(buckets::index_of(65) == 64);
+    STATIC_REQUIRE(buckets::index_of(~std::uint64_t(0)) == buckets::count - 1);
+
+    for (std::size_t a = 0; a < buckets::count; a++)
+    {
+        INFO("bucket " << a);
+        REQUIRE(buckets::index_of(buckets::lowest(a)) == a);
+        REQUIRE(buckets::index_of(buckets::highest(a)) == a);
+        if (a != 0)
+            REQUIRE(buckets::highest(a - 1) + 1 == buckets::lowest(a));
+        // Every value in a bucket is within 1/32 of its lowest value
+        REQUIRE((buckets::highest(a) - buckets::lowest(a)) <= buckets::lowest(a) / 32);
+    }
+}
+
+TEST_CASE("metrics::histogram", "[test_20][metrics]")
+{
+    ljh::metrics::histogram histogram;
+    CHECK(histogram.snapshot().count() == 0);
+    CHECK(histogram.snapshot().percentile(50) == 0);
+
+    for (std::uint64_t a = 1; a <= 1000; a++)
+        histogram.record(a);
+
+    auto snapshot = histogram.snapshot();
+    CHECK(snapshot.count() == 1000);
+    CHECK(snapshot.sum() == 500500);
+    CHECK(snapshot.min() == 1);
+    CHECK(snapshot.max() == 1000);
+    CHECK(snapshot.mean() == 500.5);
+    CHECK(snapshot.percentile(0) == 1);
+    CHECK(snapshot.percentile(100) == 1000);
+    CHECK(snapshot.percentile(50) >= 500);
+    CHECK(snapshot.percentile(50) <= 500 + 500 / 32);
+    CHECK(snapshot.percentile(99) >= 990);
+    CHECK(snapshot.percentile(99) <= 990 + 990 / 32);
+
+    ljh::metrics::histogram other;
+    other.record(5000, 10);
+    auto merged = snapshot + other.snapshot();
+    CHECK(merged.count() == 1010);
+    CHECK(merged.max() == 5000);
+    CHECK(merged.min() == 1);
+    CHECK(merged.sum() == 550500);
+
+    ljh::metrics::histogram::snapshot_type empty;
+    empty += other.snapshot();
+    CHECK(empty.min() == 5000);
+
+    histogram.reset();
+    CHECK(histogram.snapshot().count() == 0);
+    CHECK(histogram.snapshot().max() == 0);
+}
+
+TEST_CASE("metrics::histogram threads", "[test_20][metrics]")
+{
+    ljh::metrics::histogram  histogram;
+    std::vector<std::thread> threads;
+    for (int a = 0; a < 8; a++)
+        threads.emplace_back([&, a] {
+            for (std::uint64_t b = 0; b < 10000; b++)
+                histogram.record(b * 8 + a);
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    auto snapshot = histogram.snapshot();
+    CHECK(snapshot.count() == 80000);
+    CHECK(snapshot.min() == 0);
+    CHECK(snapshot.max() == 79999);
+}
+
+#if __cpp_lib_format >= 201907L
+TEST_CASE("metrics format", "[test_20][metrics]")
+{
+    ljh::metrics::counter counters[2];
+    counters[0] += 12;
+    counters[1] += 34;
+    CHECK(std::format("{}", ljh::fmt::join(counters, ", ")) == "12, 34");
+    CHECK(std::format("{:>4}", counters[0]) == "  12");
+
+    ljh::metrics::gauge gauge{-3};
+    CHECK(std::format("{}", gauge) == "-3");
+
+    ljh::metrics::histogram histogram;
+    histogram.record(7);
+    CHECK(std::format("{}", histogram) == "count=1 min=7 p50=7 p90=7 p99=7 max=7");
+}
+#endif
@@ -0,0 +1,117 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/named_mutex.hpp"
+#include "ljh/os_build_info.hpp"
+#include <chrono>
+#include <future>
+#include <thread>
+
+#if defined(LJH_TARGET_Linux)
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace ljh::compile_time_string_literals;
+using namespace std::chrono_literals;
+
+TEST_CASE("named_mutex - lock and try_lock", "[test_20][named_mutex]")
+{
+	ljh::named_mutex<"ljh_test_named_mutex_lock"_cts> mutex;
+	ljh::named_mutex<"ljh_test_named_mutex_lock"_cts> other;
+
+	mutex.lock();
+	REQUIRE_FALSE(std::async(std::launch::async, [&] { return other.try_lock(); }).get());
+	REQUIRE_FALSE(std::async(std::launch::async, [&] { return other.try_lock_for(10ms); }).get());
+	mutex.unlock();
+
+	REQUIRE(std::async(std::launch::async, [&] {
+		bool locked = other.try_lock();
+		if (locked)
+			other.unlock();
+		return locked;
+	}).get());
+
+	REQUIRE(mutex.try_lock());
+	mutex.unlock();
+}
+
+TEST_CASE("named_mutex - try_lock_for waits for unlock", "[test_20][named_mutex]")
+{
+	ljh::named_mutex<"ljh_test_named_mutex_timed"_cts> mutex;
+
+	mutex.lock();
+	auto waiter = std::async(std::launch::async, [&] {
+		bool locked = mutex.try_lock_until(std::chrono::steady_clock::now() + 5s);
+		if (locked)
+			mutex.unlock();
+		return locked;
+	});
+	std::this_thread::sleep_for(20ms);
+	mutex.unlock();
+	REQUIRE(waiter.get());
+}
+
+#if defined(LJH_TARGET_Linux)
+TEST_CASE("named_mutex - recovers when the owner dies", "[test_20][named_mutex]")
+{
+	ljh::named_mutex<"ljh_test_named_mutex_owner_died"_cts> mutex;
+
+	pid_t child = fork();
+	if (child == 0)
+	{
+		mutex.lock();
+		_exit(0);
+	}
+	REQUIRE(child > 0);
+	waitpid(child, nullptr, 0);
+
+	REQUIRE(mutex.try_lock_for(1s));
+	mutex.unlock();
+}
+
+static void leave_setup_unfinished(char const* name, std::uint32_t state)
+{
+	shm_unlink(name);
+	int fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+	REQUIRE(fd != -1);
+	REQUIRE(ftruncate(fd, 4096) == 0);
+	void* memory = mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	REQUIRE(memory != MAP_FAILED);
+	static_cast<std::atomic<std::uint32_t>*>(memory)->store(state);
+	munmap(memory, 4096);
+}
+
+TEST_CASE("named_mutex - takes over when setting up never finishes", "[test_20][named_mutex]")
+{
+	// Leave the state word at the first attempt, as a process that died setting the mutex up would
+	leave_setup_unfinished("/ljh_test_named_mutex_setup_died", 1);
+
+	auto start = std::chrono::steady_clock::now();
+	ljh::named_mutex<"ljh_test_named_mutex_setup_died"_cts> mutex;
+	ljh::named_mutex<"ljh_test_named_mutex_setup_died"_cts> other;
+	REQUIRE(std::chrono::steady_clock::now() - start < 5s);
+
+	mutex.lock();
+	REQUIRE_FALSE(std::async(std::launch::async, [&] { return other.try_lock(); }).get());
+	mutex.unlock();
+	REQUIRE(other.try_lock());
+	other.unlock();
+}
+
+TEST_CASE("named_mutex - gives up after the last takeover", "[test_20][named_mutex]")
+{
+	// The last attempt never finishing leaves no spare mutex to take over with
+	leave_setup_unfinished("/ljh_test_named_mutex_setup_gave_up", 4);
+
+	ljh::named_mutex<"ljh_test_named_mutex_setup_gave_up"_cts> mutex;
+	REQUIRE_FALSE(mutex.try_lock());
+}
+#endif
@@ -8,6 +8,7 @@
 #include "ljh/ranges/terminators.hpp"
 #include "ljh/ranges/views.hpp"
 #include "ljh/ranges/actions.hpp"
+#include "ljh/string_utils.hpp"
 
 #if __cpp_lib_ranges
 
@@ -105,4 +106,18 @@ TEST_CASE("last", "[test_20][ranges][adaptor]")
 	}
 }
 
+TEST_CASE("split_lazy", "[test_20][ranges][adaptor]")
+{
+	using namespace std::literals;
+	auto text  = "1,22,,333"sv;
+	auto sizes = text | ljh::ranges::views::split_lazy(',') | std::views::transform([](std::string_view s) { return s.size(); });
+	static_assert(std::ranges::forward_range<decltype(sizes)>);
+
+	std::vector<std::size_t> output(sizes.begin(), sizes.end());
+	CHECK(output == std::vector<std::size_t>{1, 2, 0, 3});
+
+	auto words = ljh::ranges::views::split_lazy("a--b--c", "--") | std::views::drop(1);
+	CHECK(std::ranges::equal(words, std::vector{"b"sv, "c"sv}));
+}
+
 #endif
\ No newline at end of file
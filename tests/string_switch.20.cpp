@@ -0,0 +1,59 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/string_switch.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::literals;
+using namespace ljh::compile_time_string_literals;
+
+using verbs   = ljh::string_switch<"GET"_cts, "POST"_cts, "PUT"_cts, "DELETE"_cts, "PATCH"_cts, "HEAD"_cts>;
+using headers = ljh::string_switch<"accept"_cts, "accept-charset"_cts, "accept-encoding"_cts, "accept-language"_cts, "authorization"_cts,
+                                   "cache-control"_cts, "connection"_cts, "content-length"_cts, "content-type"_cts, "cookie"_cts, "date"_cts,
+                                   "expect"_cts, "from"_cts, "host"_cts, "if-match"_cts, "if-modified-since"_cts, "if-none-match"_cts,
+                                   "if-range"_cts, "if-unmodified-since"_cts, "max-forwards"_cts, "origin"_cts, "pragma"_cts, "range"_cts,
+                                   "referer"_cts, "te"_cts, "upgrade"_cts, "user-agent"_cts, "via"_cts, "warning"_cts, ""_cts>;
+
+TEST_CASE("string_switch - small", "[test_20][string_switch]")
+{
+    static_assert(verbs::size == 6);
+    static_assert(verbs::find("POST") == 1);
+    static_assert(verbs::index_of<"HEAD"_cts> == 5);
+
+    REQUIRE(verbs::find("GET"sv) == 0);
+    REQUIRE(verbs::find("DELETE"sv) == 3);
+    REQUIRE(verbs::find("PATCH"sv) == 4);
+    REQUIRE(verbs::find("GETS"sv) == verbs::npos);
+    REQUIRE(verbs::find("GE"sv) == verbs::npos);
+    REQUIRE(verbs::find("get"sv) == verbs::npos);
+    REQUIRE(verbs::find(""sv) == verbs::npos);
+    REQUIRE(verbs::key(2) == "PUT"sv);
+
+    using long_keys = ljh::string_switch<"content-length"_cts, "content-type"_cts>;
+    REQUIRE(long_keys::find("content-type"sv) == 1);
+    REQUIRE(long_keys::find("content-typo"sv) == long_keys::npos);
+}
+
+TEST_CASE("string_switch - perfect hash", "[test_20][string_switch]")
+{
+    static_assert(headers::find("host") == headers::index_of<"host"_cts>);
+
+    for (std::size_t a = 0; a < headers::size; a++)
+        REQUIRE(headers::find(headers::key(a)) == a);
+
+    REQUIRE(headers::find("content-typ"sv) == headers::npos);
+    REQUIRE(headers::find("x-forwarded-for"sv) == headers::npos);
+    REQUIRE(headers::find("Host"sv) == headers::npos);
+}
+
+TEST_CASE("string_switch - other characters", "[test_20][string_switch]")
+{
+    using wide = ljh::string_switch<u"été"_cts, u"hiver"_cts>;
+    REQUIRE(wide::find(u"hiver"sv) == 1);
+    REQUIRE(wide::find(u"printemps"sv) == wide::npos);
+
+    using empty = ljh::string_switch<>;
+    REQUIRE(empty::find("anything"sv) == empty::npos);
+}
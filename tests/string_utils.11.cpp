@@ -52,4 +52,32 @@ TEST_CASE("trim_copy","[test_11][string_util]")
 	std::string copy = ljh::trim_copy(message);
 	REQUIRE(copy == "AAAAA     AAAAA");
 	REQUIRE(copy != message);
-}
\ No newline at end of file
+}
+
+TEST_CASE("is_space","[test_11][string_util]")
+{
+	REQUIRE(ljh::is_space(' '));
+	REQUIRE(ljh::is_space('\t'));
+	REQUIRE(ljh::is_space('\r'));
+	REQUIRE_FALSE(ljh::is_space('a'));
+	REQUIRE_FALSE(ljh::is_space('\0'));
+	REQUIRE_FALSE(ljh::is_space(char(0xA0)));
+	REQUIRE(ljh::is_space(u'\u00A0'));
+	REQUIRE(ljh::is_space(U'\u3000'));
+	REQUIRE(ljh::is_space(L'\u2009'));
+	REQUIRE_FALSE(ljh::is_space(U'\u200B'));
+}
+
+TEST_CASE("trim long padding","[test_11][string_util]")
+{
+	std::string message = std::string(37, ' ') + "\tA B\n" + std::string(21, ' ');
+	ljh::trim(message);
+	REQUIRE(message == "A B");
+}
+
+TEST_CASE("trim unicode","[test_11][string_util]")
+{
+	std::u32string message{U"\u3000\u00A0 text \u2028"};
+	ljh::trim(message);
+	REQUIRE(message == U"text");
+}
@@ -0,0 +1,55 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/string_utils.hpp"
+
+using namespace std::literals;
+
+template<typename R>
+static std::vector<std::string_view> collect(R&& range)
+{
+    std::vector<std::string_view> output;
+    for (auto item : range)
+        output.push_back(item);
+    return output;
+}
+
+TEST_CASE("split_lazy matches split", "[test_17][string_util]")
+{
+    for (auto text : {""sv, ","sv, "a"sv, "a,b,,c"sv, ",a,"sv, "aaa,bbb,ccc"sv})
+    {
+        REQUIRE(collect(ljh::split_lazy(text, ',')) == ljh::split(text, ','));
+        REQUIRE(collect(ljh::split_lazy(text, ',', 2)) == ljh::split(text, ',', 2));
+    }
+}
+
+TEST_CASE("split_lazy multi character separator", "[test_17][string_util]")
+{
+    auto text = "key: value: more"sv;
+    REQUIRE(collect(ljh::split_lazy(text, ": ")) == ljh::split(text, ": "));
+    REQUIRE(collect(ljh::split_lazy(text, ": "sv)) == std::vector{"key"sv, "value"sv, "more"sv});
+    REQUIRE(collect(ljh::split_lazy(text, ": ", 2)) == std::vector{"key"sv, "value: more"sv});
+}
+
+TEST_CASE("split_lazy iterators", "[test_17][string_util]")
+{
+    auto view = ljh::split_lazy("a|b"sv, '|');
+    auto it   = view.begin();
+    REQUIRE(it != view.end());
+    REQUIRE(*it++ == "a"sv);
+    REQUIRE(*it == "b"sv);
+    REQUIRE(++it == view.end());
+}
+
+TEST_CASE("trim_view", "[test_17][string_util]")
+{
+    std::string message{"   AAAAA  AAAAA \t"};
+    REQUIRE(ljh::trim_view(message) == "AAAAA  AAAAA"sv);
+    REQUIRE(ljh::ltrim_view(message) == "AAAAA  AAAAA \t"sv);
+    REQUIRE(ljh::rtrim_view(message) == "   AAAAA  AAAAA"sv);
+    REQUIRE(ljh::trim_view(message).data() == message.data() + 3);
+    REQUIRE(message == "   AAAAA  AAAAA \t");
+}
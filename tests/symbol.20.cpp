@@ -0,0 +1,68 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/symbol.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("symbol - interning", "[test_20][symbol]")
+{
+    std::string text = "status_code";
+    ljh::symbol a    = ljh::intern(text);
+    ljh::symbol b    = ljh::intern("status_code"sv);
+    ljh::symbol c    = ljh::intern("status_text"sv);
+
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(a.id() == b.id());
+    REQUIRE(a.view() == "status_code"sv);
+    REQUIRE(a.view().data() != text.data());
+    REQUIRE(std::string{a.c_str()} == "status_code");
+    REQUIRE(std::hash<ljh::symbol>{}(a) == std::hash<ljh::symbol>{}(b));
+
+    REQUIRE(ljh::symbol{} == ljh::intern(""sv));
+    REQUIRE(ljh::symbol{}.empty());
+    REQUIRE(ljh::symbol{}.view() == ""sv);
+    REQUIRE(ljh::symbol{}.id() == 0);
+}
+
+TEST_CASE("symbol - literals", "[test_20][symbol]")
+{
+    using namespace ljh::symbol_literals;
+    using namespace ljh::compile_time_string_literals;
+
+    REQUIRE("route"_sym == ljh::intern("route"sv));
+    REQUIRE("route"_sym == ljh::static_symbol<"route"_cts>);
+    REQUIRE("route"_sym.view() == "route"sv);
+    REQUIRE(""_sym.empty());
+}
+
+TEST_CASE("symbol - concurrent interning", "[test_20][symbol]")
+{
+    constexpr int                         thread_count = 8;
+    constexpr int                         string_count = 2000;
+    std::vector<std::vector<ljh::symbol>> results(thread_count);
+    std::vector<std::thread>              threads;
+
+    for (int t = 0; t < thread_count; t++)
+        threads.emplace_back([&, t] {
+            for (int a = 0; a < string_count; a++)
+                results[t].push_back(ljh::intern("label_" + std::to_string(a)));
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    std::unordered_set<ljh::symbol> unique(results[0].begin(), results[0].end());
+    REQUIRE(unique.size() == string_count);
+    for (int t = 1; t < thread_count; t++)
+        REQUIRE(results[t] == results[0]);
+    for (int a = 0; a < string_count; a++)
+        REQUIRE(results[0][a].view() == "label_" + std::to_string(a));
+}
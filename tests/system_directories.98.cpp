@@ -61,3 +61,18 @@ TEST_CASE("system_directories::save_games()", "[test_98][system_directories]")
 {
 	REQUIRE(!ljh::system_directories::save_games().empty());
 }
+
+TEST_CASE("system_directories::cached()", "[test_98][system_directories]")
+{
+	ljh::system_directories::directory_table const& table = ljh::system_directories::cached();
+	REQUIRE(&table == &ljh::system_directories::cached());
+	REQUIRE(table.home == ljh::system_directories::home());
+	REQUIRE(table.documents == ljh::system_directories::documents());
+	REQUIRE(table.save_games == ljh::system_directories::save_games());
+
+	ljh::system_directories::invalidate();
+	ljh::system_directories::directory_table const& rebuilt = ljh::system_directories::cached();
+	REQUIRE(&rebuilt != &table);
+	REQUIRE(rebuilt.home == table.home);
+	REQUIRE(table.home == ljh::system_directories::home());
+}
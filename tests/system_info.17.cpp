@@ -66,4 +66,44 @@ TEST_CASE("system_info::get_manufacturer()", "[test_17][system_info]")
 	REQUIRE(!test.value().empty());
 #endif
 }
-#endif
\ No newline at end of file
+#endif
+
+TEST_CASE("system_info::get_hardware()", "[test_17][system_info]")
+{
+	auto test = ljh::system_info::get_hardware();
+	REQUIRE(test.has_value());
+	REQUIRE(test->logical_cores > 0);
+	REQUIRE(test->page_size > 0);
+	REQUIRE(test->physical_cores <= test->logical_cores);
+	for (auto& cache : test->caches)
+		REQUIRE(cache.level > 0);
+}
+
+TEST_CASE("system_info::snapshot()", "[test_17][system_info]")
+{
+	auto& first = ljh::system_info::snapshot();
+	REQUIRE(&first == &ljh::system_info::snapshot());
+	REQUIRE(first.platform == ljh::system_info::get_platform());
+	REQUIRE(first.version == ljh::system_info::get_version());
+
+	auto& refreshed = ljh::system_info::refresh();
+	REQUIRE(&refreshed != &first);
+	REQUIRE(&refreshed == &ljh::system_info::snapshot());
+	REQUIRE(first.platform == refreshed.platform);
+}
+
+TEST_CASE("system_info::cpu_features()", "[test_17][system_info]")
+{
+	using ljh::system_info::cpu_feature;
+	auto features = ljh::system_info::cpu_features();
+	REQUIRE(features == ljh::system_info::cpu_features());
+	REQUIRE(ljh::system_info::has_cpu_features(cpu_feature::none));
+#if defined(__x86_64__) || defined(_M_X64)
+	REQUIRE(ljh::system_info::has_cpu_features(cpu_feature::sse2));
+	REQUIRE(!ljh::system_info::has_cpu_features(cpu_feature::neon));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	REQUIRE(ljh::system_info::has_cpu_features(cpu_feature::neon));
+#endif
+	if (ljh::system_info::has_cpu_features(cpu_feature::avx2))
+		REQUIRE(ljh::system_info::has_cpu_features(cpu_feature::avx));
+}
@@ -0,0 +1,73 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include "ljh/typename.hpp"
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace typename_test
+{
+	struct widget
+	{};
+	class gadget
+	{};
+	enum class colour
+	{
+		red
+	};
+	template<typename T>
+	struct box
+	{};
+} // namespace typename_test
+
+using namespace std::literals;
+
+static_assert(ljh::type_name<int>() == "int"sv);
+static_assert(ljh::type_id<int>() == ljh::type_id<int>());
+static_assert(ljh::type_id<int>() != ljh::type_id<unsigned int>());
+
+TEST_CASE("type_name", "[test_17][typename]")
+{
+	REQUIRE(ljh::type_name<double>() == "double"sv);
+	REQUIRE(ljh::type_name<int const*>().find('*') != std::string_view::npos);
+	REQUIRE(ljh::type_name<typename_test::widget>() == "typename_test::widget"sv);
+	REQUIRE(ljh::type_name<typename_test::gadget>() == "typename_test::gadget"sv);
+	REQUIRE(ljh::type_name<typename_test::colour>() == "typename_test::colour"sv);
+	REQUIRE(ljh::type_name<typename_test::box<typename_test::widget>>() == "typename_test::box<typename_test::widget>"sv);
+}
+
+TEST_CASE("type_name - static storage", "[test_17][typename]")
+{
+	auto name = ljh::type_name<typename_test::widget>();
+	REQUIRE(name.data() == ljh::type_name<typename_test::widget>().data());
+	REQUIRE(name.data()[name.size()] == '\0');
+	REQUIRE(std::strlen(name.data()) == name.size());
+}
+
+static int kind(std::uint64_t id)
+{
+	switch (id)
+	{
+	case ljh::type_id<int>():
+		return 1;
+	case ljh::type_id<typename_test::widget>():
+		return 2;
+	case ljh::type_id<std::vector<int>>():
+		return 3;
+	default:
+		return 0;
+	}
+}
+
+TEST_CASE("type_id", "[test_17][typename]")
+{
+	REQUIRE(kind(ljh::type_id<int>()) == 1);
+	REQUIRE(kind(ljh::type_id<typename_test::widget>()) == 2);
+	REQUIRE(kind(ljh::type_id<std::vector<int>>()) == 3);
+	REQUIRE(kind(ljh::type_id<typename_test::gadget>()) == 0);
+	REQUIRE(ljh::type_id<typename_test::box<int>>() != ljh::type_id<typename_test::box<long>>());
+}
@@ -0,0 +1,70 @@
+//          Copyright Jared Irwin 2026
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ljh/utf.hpp"
+#include "ljh/string_utils.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace std::literals;
+
+// "aé€😀" followed by a long ascii run
+static constexpr auto utf8  = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 the quick brown fox"sv;
+static constexpr auto utf16 = u"aé€\U0001F600 the quick brown fox"sv;
+static constexpr auto utf32 = U"aé€\U0001F600 the quick brown fox"sv;
+
+TEST_CASE("transcode", "[test_17][utf]")
+{
+    REQUIRE(ljh::transcode<char16_t>(utf8) == utf16);
+    REQUIRE(ljh::transcode<char32_t>(utf8) == utf32);
+    REQUIRE(ljh::transcode<char>(utf16) == utf8);
+    REQUIRE(ljh::transcode<char32_t>(utf16) == utf32);
+    REQUIRE(ljh::transcode<char>(utf32) == utf8);
+    REQUIRE(ljh::transcode<char16_t>(utf32) == utf16);
+}
+
+TEST_CASE("transcoded_length", "[test_17][utf]")
+{
+    REQUIRE(ljh::transcoded_length<char16_t>(utf8) == utf16.size());
+    REQUIRE(ljh::transcoded_length<char32_t>(utf8) == utf32.size());
+    REQUIRE(ljh::transcoded_length<char>(utf32) == utf8.size());
+}
+
+TEST_CASE("transcode_into", "[test_17][utf]")
+{
+    char16_t buffer[4];
+    auto     res = ljh::transcode_into(utf8, buffer, 4);
+    REQUIRE(res.ec == std::errc::no_buffer_space);
+    REQUIRE(res.out == buffer + 3);
+    REQUIRE(res.in == utf8.data() + 6);
+    REQUIRE(std::u16string_view(buffer, 3) == utf16.substr(0, 3));
+
+    char16_t big[64];
+    res = ljh::transcode_into(utf8, big, 64);
+    REQUIRE(res.ec == std::errc{});
+    REQUIRE(std::u16string_view(big, res.out - big) == utf16);
+}
+
+TEST_CASE("invalid input", "[test_17][utf]")
+{
+    REQUIRE(ljh::is_valid_utf(utf8));
+    REQUIRE(ljh::is_valid_utf(utf16));
+    REQUIRE(ljh::is_valid_utf("\xEF\xBF\xBD"sv));
+
+    REQUIRE(ljh::find_invalid_utf("ab\xC0\xAF"sv) == 2);         // overlong
+    REQUIRE(ljh::find_invalid_utf("abc\xED\xA0\x80"sv) == 3);    // surrogate
+    REQUIRE(ljh::find_invalid_utf("\xF4\x90\x80\x80"sv) == 0);   // above U+10FFFF
+    REQUIRE(ljh::find_invalid_utf(u"a\xD800"sv) == 1);           // lone surrogate
+    REQUIRE(ljh::find_invalid_utf(U"\x110000"sv) == 0);
+
+    REQUIRE(ljh::transcode<char32_t>("a\xE2\x82z"sv) == U"a�z"sv);
+    REQUIRE(ljh::transcode<char32_t>("\xC0\xAF"sv) == U"��"sv);
+    REQUIRE(ljh::transcode<char>(u"\xDC00x"sv) == "\xEF\xBF\xBDx"sv);
+}
+
+TEST_CASE("convert_string", "[test_17][utf]")
+{
+    REQUIRE(ljh::convert_string(ljh::convert_string(utf8)) == utf8);
+    REQUIRE(ljh::convert_string("plain"sv) == L"plain"s);
+}
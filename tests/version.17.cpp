@@ -124,4 +124,75 @@ TEST_CASE("version compare - less then equal to", "[test_17][version]")
 	CHECK(ljh::version{1,2,2,4} <= ljh::version{1,2,3,4});
 	CHECK(ljh::version{1,1,3,4} <= ljh::version{1,2,3,4});
 	CHECK(ljh::version{0,2,3,4} <= ljh::version{1,2,3,4});
-}
\ No newline at end of file
+}
+
+TEST_CASE("version compare - earlier parts win", "[test_17][version]")
+{
+	CHECK(ljh::version{1,2,3,4} > ljh::version{0,3,4,5});
+	CHECK(ljh::version{1,2,3,4} > ljh::version{1,1,4,5});
+	CHECK(ljh::version{1,2,3,4} > ljh::version{1,2,2,5});
+	CHECK_FALSE(ljh::version{1,2,3,4} < ljh::version{0,3,4,5});
+}
+
+TEST_CASE("version from_chars", "[test_17][version]")
+{
+	static_assert(ljh::version{"10.0.19041"sv} == ljh::version{10,0,19041,0});
+
+	ljh::version value;
+	auto text = "1.22.333.4444-beta"sv;
+	auto res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ec == std::errc{});
+	CHECK(res.ptr == text.data() + 13);
+	CHECK_THAT(value, EqualsVersion({1,22,333,4444}));
+
+	text = "1.2.3.4.5"sv;
+	res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ptr == text.data() + 7);
+	CHECK_THAT(value, EqualsVersion({1,2,3,4}));
+
+	text = "v1.2"sv;
+	res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ec == std::errc::invalid_argument);
+	CHECK(res.ptr == text.data());
+
+	text = "1.99999999999"sv;
+	res = ljh::from_chars(text.data(), text.data() + text.size(), value);
+	CHECK(res.ec == std::errc::result_out_of_range);
+
+	CHECK_THAT(ljh::version{L"4.3.2.1"}, EqualsVersion({4,3,2,1}));
+}
+
+TEST_CASE("version_range_set", "[test_17][version]")
+{
+	ljh::version_range_set set{
+		{{1,0}, {1,9}},
+		{{3,0}, {3,5}},
+		{{1,5}, {2,0}},
+	};
+	REQUIRE(set.size() == 2);
+	CHECK_THAT(set.begin()->first, EqualsVersion({1,0}));
+	CHECK_THAT(set.begin()->last , EqualsVersion({2,0}));
+
+	CHECK(set.contains({1,4,2}));
+	CHECK(set.contains({2,0}));
+	CHECK_FALSE(set.contains({2,0,1}));
+	CHECK_FALSE(set.contains({0,9}));
+	CHECK(set.contains({3,5}));
+	CHECK_FALSE(set.contains({3,5,0,1}));
+	CHECK(set.find({3,1}) == &*std::next(set.begin()));
+	CHECK(set.find({9}) == nullptr);
+
+	set.insert({{0,1}, {4,0}});
+	REQUIRE(set.size() == 1);
+
+	ljh::version_range_set sparse{{{1}, {1,5}}, {{2}, {2,5}}};
+	std::vector<ljh::version> sorted{{0,5}, {1,2}, {1,7}, {2}, {2,4}, {3}};
+	std::vector<bool> results;
+	sparse.contains(sorted.begin(), sorted.end(), std::back_inserter(results));
+	CHECK(results == std::vector<bool>{false, true, false, true, true, false});
+
+	std::vector<ljh::version> unsorted{{3}, {2,4}, {0,5}};
+	results.clear();
+	sparse.contains(unsorted.begin(), unsorted.end(), std::back_inserter(results));
+	CHECK(results == std::vector<bool>{false, true, false});
+}